@@ -44,6 +44,8 @@ function(build_pele_exe pele_exe_name pele_physics_lib_name)
        ${SRC_DIR}/EBStencilTypes.H
        ${SRC_DIR}/External.cpp
        ${SRC_DIR}/Forcing.cpp
+       ${SRC_DIR}/FusedFilter.H
+       ${SRC_DIR}/FusedFilter.cpp
        ${SRC_DIR}/GradUtil.H
        ${SRC_DIR}/Hydro.H
        ${SRC_DIR}/Hydro.cpp
@@ -67,16 +69,22 @@ function(build_pele_exe pele_exe_name pele_physics_lib_name)
        ${SRC_DIR}/PeleCAmr.H
        ${SRC_DIR}/PeleCAmr.cpp
        ${SRC_DIR}/ProblemSpecificFunctions.H
+       ${SRC_DIR}/Probes.H
+       ${SRC_DIR}/Probes.cpp
        ${SRC_DIR}/React.cpp
        ${SRC_DIR}/Riemann.H
        ${SRC_DIR}/Setup.cpp
        ${SRC_DIR}/Sources.cpp
+       ${SRC_DIR}/Stats.cpp
        ${SRC_DIR}/SparseData.H
        ${SRC_DIR}/SumIQ.cpp
        ${SRC_DIR}/SumUtils.cpp
+       ${SRC_DIR}/Table.H
        ${SRC_DIR}/Tagging.H
        ${SRC_DIR}/Tagging.cpp
        ${SRC_DIR}/Timestep.H
+       ${SRC_DIR}/Telemetry.H
+       ${SRC_DIR}/Telemetry.cpp
        ${SRC_DIR}/TransCoeff.H
        ${SRC_DIR}/Utilities.H
        ${SRC_DIR}/Utilities.cpp
@@ -111,7 +119,8 @@ function(build_pele_exe pele_exe_name pele_physics_lib_name)
     endif()
   endif()
 
-  if(NOT "${pele_exe_name}" STREQUAL "${PROJECT_NAME}-UnitTests")
+  if(NOT "${pele_exe_name}" STREQUAL "${PROJECT_NAME}-UnitTests" AND
+     NOT "${pele_exe_name}" MATCHES "^${PROJECT_NAME}-bench-")
     target_sources(${pele_exe_name}
        PRIVATE
          ${CMAKE_SOURCE_DIR}/Source/main.cpp
@@ -0,0 +1,358 @@
+#include "bench-kernels.H"
+#include "Utilities.H"
+#include "TransCoeff.H"
+#include "Diffterm.H"
+#include "Hydro.H"
+#include "MOL.H"
+
+namespace pelec_bench {
+
+KernelBench::KernelBench(int box_size, const std::string& chem_integrator)
+{
+  const amrex::Box domain(
+    amrex::IntVect(AMREX_D_DECL(0, 0, 0)),
+    amrex::IntVect(AMREX_D_DECL(box_size - 1, box_size - 1, box_size - 1)));
+  const amrex::RealBox rb(
+    {AMREX_D_DECL(0.0, 0.0, 0.0)}, {AMREX_D_DECL(1.0, 1.0, 1.0)});
+  const amrex::Array<int, AMREX_SPACEDIM> is_periodic{
+    AMREX_D_DECL(1, 1, 1)};
+  m_geom.define(domain, rb, amrex::CoordSys::cartesian, is_periodic);
+
+  // A single box, owned by every rank, so that there is no communication
+  m_ba.define(domain);
+  amrex::Vector<int> pmap(1, amrex::ParallelDescriptor::MyProc());
+  m_dm.define(std::move(pmap));
+
+  m_state.define(m_ba, m_dm, NVAR, m_ng);
+  m_q.define(m_ba, m_dm, QVAR, m_ng);
+  m_qaux.define(m_ba, m_dm, NQAUX, m_ng);
+  m_srcq.define(m_ba, m_dm, QVAR, m_ng);
+  m_coef.define(m_ba, m_dm, m_ncoef, m_ng);
+  m_dudt.define(m_ba, m_dm, NVAR, 0);
+  m_vol.define(m_ba, m_dm, 1, m_ng);
+  for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+    const amrex::BoxArray eba =
+      amrex::convert(m_ba, amrex::IntVect::TheDimensionVector(dir));
+    m_flux[dir].define(eba, m_dm, NVAR, 0);
+    m_area[dir].define(eba, m_dm, 1, m_ng);
+  }
+  m_flags.define(m_ba, m_dm, 1, m_ng);
+  m_flags.setVal(amrex::EBCellFlag::TheDefaultCell());
+
+  m_react_state.define(m_ba, m_dm, NUM_SPECIES + 2, 0);
+  m_react_src.define(m_ba, m_dm, NUM_SPECIES + 1, 0);
+  m_fct_count.define(m_ba, m_dm, 1, 0);
+  m_mask.define(m_ba, m_dm, 1, 0);
+  m_mask.setVal(1);
+
+  m_prob_parm_device = static_cast<ProbParmDevice*>(
+    amrex::The_Arena()->alloc(sizeof(ProbParmDevice)));
+  const ProbParmDevice h_prob_parm_device{};
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, &h_prob_parm_device, &h_prob_parm_device + 1,
+    m_prob_parm_device);
+  m_trans_parms.initialize();
+
+  m_reactor = pele::physics::reactions::ReactorBase::create(chem_integrator);
+  m_reactor->init(1, 1);
+
+  initState();
+}
+
+KernelBench::~KernelBench()
+{
+  m_reactor->close();
+  m_trans_parms.deallocate();
+  amrex::The_Arena()->free(m_prob_parm_device);
+}
+
+const amrex::Vector<std::string>&
+KernelBench::kernels()
+{
+  static const amrex::Vector<std::string> names{
+    "ctoprim", "transcoeff", "diffusion_flux", "riemann",
+    "mol_flux", "umdrv",     "react"};
+  return names;
+}
+
+amrex::Real
+KernelBench::bytesPerCell(const std::string& kernel)
+{
+  // Compulsory traffic of the arrays read and written by the kernel, ignoring
+  // ghost cells and temporaries
+  int nwords = 0;
+  if (kernel == "ctoprim") {
+    nwords = NVAR + QVAR + NQAUX;
+  } else if (kernel == "transcoeff") {
+    nwords = NUM_SPECIES + 2 + m_ncoef;
+  } else if (kernel == "diffusion_flux") {
+    nwords = QVAR + m_ncoef + AMREX_SPACEDIM * (NVAR + 1);
+  } else if (kernel == "riemann") {
+    nwords = QVAR + NQAUX + NVAR;
+  } else if (kernel == "mol_flux") {
+    nwords = QVAR + NQAUX + AMREX_SPACEDIM * (NVAR + 1);
+  } else if (kernel == "umdrv") {
+    nwords = NVAR + 2 * QVAR + NQAUX + NVAR + AMREX_SPACEDIM * (NVAR + 1) + 1;
+  } else if (kernel == "react") {
+    nwords = 2 * (NUM_SPECIES + 2) + NUM_SPECIES + 1;
+  } else {
+    amrex::Abort("Unknown benchmark kernel " + kernel);
+  }
+  return static_cast<amrex::Real>(nwords * sizeof(amrex::Real));
+}
+
+void
+KernelBench::initState()
+{
+  // Smooth periodic fields of velocity, temperature and composition, so that
+  // every code path sees gradients and a nontrivial mixture
+  const auto geomdata = m_geom.data();
+  auto const& sarrs = m_state.arrays();
+  amrex::ParallelFor(
+    m_state, amrex::IntVect(m_ng),
+    [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+      const amrex::RealVect x = pc_cmp_loc({AMREX_D_DECL(i, j, k)}, geomdata);
+      const amrex::Real twopi = 2.0 * constants::PI();
+      const amrex::Real phase = AMREX_D_TERM(
+        std::sin(twopi * x[0]), +std::cos(twopi * x[1]),
+        +std::sin(twopi * x[2]));
+      const amrex::Real p = 1.01325e6;
+      const amrex::Real T = 1000.0 + 400.0 * phase / AMREX_SPACEDIM;
+      amrex::Real massfrac[NUM_SPECIES] = {0.0};
+      amrex::Real sum = 0.0;
+      for (int n = 0; n < NUM_SPECIES; ++n) {
+        massfrac[n] = 1.0 + 0.5 * std::sin(twopi * x[0] + n);
+        sum += massfrac[n];
+      }
+      for (int n = 0; n < NUM_SPECIES; ++n) {
+        massfrac[n] /= sum;
+      }
+      amrex::Real rho = 0.0, eint = 0.0;
+      auto eos = pele::physics::PhysicsType::eos();
+      eos.PYT2RE(p, massfrac, T, rho, eint);
+
+      const amrex::Real u[3] = {
+        1.0e3 * std::sin(twopi * x[0]), -1.0e3 * std::cos(twopi * x[0]),
+        5.0e2 * phase};
+      auto const& s = sarrs[nbx];
+      s(i, j, k, URHO) = rho;
+      s(i, j, k, UMX) = rho * u[0];
+      s(i, j, k, UMY) = rho * u[1];
+      s(i, j, k, UMZ) = rho * u[2];
+      s(i, j, k, UEINT) = rho * eint;
+      s(i, j, k, UEDEN) =
+        rho * (eint + 0.5 * (u[0] * u[0] + u[1] * u[1] + u[2] * u[2]));
+      s(i, j, k, UTEMP) = T;
+      for (int n = 0; n < NUM_SPECIES; ++n) {
+        s(i, j, k, UFS + n) = rho * massfrac[n];
+      }
+#if NUM_ADV > 0
+      for (int n = 0; n < NUM_ADV; ++n) {
+        s(i, j, k, UFA + n) = 0.0;
+      }
+#endif
+#if NUM_AUX > 0
+      for (int n = 0; n < NUM_AUX; ++n) {
+        s(i, j, k, UFX + n) = 0.0;
+      }
+#endif
+    });
+
+  const amrex::Real* dx = m_geom.CellSize();
+  const amrex::Real cell_vol = AMREX_D_TERM(dx[0], *dx[1], *dx[2]);
+  m_vol.setVal(cell_vol);
+  for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+    m_area[dir].setVal(cell_vol / dx[dir]);
+  }
+  m_srcq.setVal(0.0);
+  m_fct_count.setVal(0.0);
+  amrex::Gpu::synchronize();
+
+  // Primitive variables and transport coefficients are inputs to the flux
+  // kernels, so compute them once here
+  runKernel("ctoprim", amrex::IntVect(1024));
+  runKernel("transcoeff", amrex::IntVect(1024));
+}
+
+amrex::Real
+KernelBench::run(
+  const std::string& kernel, const amrex::IntVect& tile_size, int nrep)
+{
+  // Warm up (first touch, reactor and arena allocations)
+  runKernel(kernel, tile_size);
+
+  amrex::Real wt = amrex::ParallelDescriptor::second();
+  for (int rep = 0; rep < nrep; ++rep) {
+    runKernel(kernel, tile_size);
+  }
+  wt = amrex::ParallelDescriptor::second() - wt;
+
+  return wt / amrex::max(nrep, 1);
+}
+
+void
+KernelBench::runKernel(
+  const std::string& kernel, const amrex::IntVect& tile_size)
+{
+  BL_PROFILE("KernelBench::runKernel(" + kernel + ")");
+
+  const amrex::MFItInfo mfi_info =
+    amrex::MFItInfo().EnableTiling(tile_size).SetDynamic(true);
+  const auto dxinv = m_geom.InvCellSizeArray();
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+  for (amrex::MFIter mfi(m_state, mfi_info); mfi.isValid(); ++mfi) {
+    const amrex::Box& bx = mfi.tilebox();
+    auto const& s = m_state.const_array(mfi);
+    auto const& q = m_q.array(mfi);
+    auto const& qaux = m_qaux.array(mfi);
+    auto const& coef = m_coef.array(mfi);
+
+    if (kernel == "ctoprim") {
+      const amrex::Box gbx = mfi.growntilebox(m_ng);
+      amrex::ParallelFor(
+        gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          pc_ctoprim(i, j, k, s, q, qaux);
+        });
+
+    } else if (kernel == "transcoeff") {
+      const amrex::Box gbx = mfi.growntilebox(m_ng);
+      auto const* ltransparm = m_trans_parms.device_parm();
+      const ProbParmDevice* lprobparm = m_prob_parm_device;
+      const auto geomdata = m_geom.data();
+      amrex::ParallelFor(
+        gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          amrex::Real mu, xi, lam;
+          amrex::Real Ddiag[NUM_SPECIES], Y[NUM_SPECIES] = {0.0};
+          for (int n = 0; n < NUM_SPECIES; ++n) {
+            Y[n] = q(i, j, k, QFS + n);
+          }
+          const amrex::RealVect x =
+            pc_cmp_loc({AMREX_D_DECL(i, j, k)}, geomdata);
+          pc_transcoeff(
+            true, true, true, true, false, q(i, j, k, QTEMP), q(i, j, k, QRHO),
+            Y, Ddiag, nullptr, mu, xi, lam, ltransparm, *lprobparm, x);
+          for (int n = 0; n < NUM_SPECIES; ++n) {
+            coef(i, j, k, dComp_rhoD + n) = Ddiag[n];
+          }
+          coef(i, j, k, dComp_mu) = mu;
+          coef(i, j, k, dComp_xi) = xi;
+          coef(i, j, k, dComp_lambda) = lam;
+        });
+
+    } else if (kernel == "diffusion_flux") {
+      const auto& coe_cc = m_coef.const_array(mfi);
+      const auto& qc = m_q.const_array(mfi);
+      for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        const amrex::Box ebx = amrex::surroundingNodes(bx, dir);
+        auto const& flx = m_flux[dir].array(mfi);
+        auto const& area = m_area[dir].const_array(mfi);
+        amrex::ParallelFor(
+          ebx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            amrex::GpuArray<amrex::Real, dComp_lambda + 1> cf = {0.0};
+            for (int n = 0; n < static_cast<int>(cf.size()); n++) {
+              pc_move_transcoefs_to_ec(
+                AMREX_D_DECL(i, j, k), n, coe_cc, cf.data(), dir, false);
+            }
+            pc_diffusion_flux(i, j, k, qc, cf, area, flx, dxinv, dir);
+          });
+      }
+
+    } else if (kernel == "riemann") {
+      // Piecewise constant states on either side of the x faces
+      const amrex::Box ebx = amrex::surroundingNodes(bx, 0);
+      const auto& qc = m_q.const_array(mfi);
+      const auto& qa = m_qaux.const_array(mfi);
+      auto const& flx = m_flux[0].array(mfi);
+      amrex::ParallelFor(
+        ebx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          amrex::Real spl[NUM_SPECIES], spr[NUM_SPECIES];
+          for (int n = 0; n < NUM_SPECIES; n++) {
+            spl[n] = qc(i - 1, j, k, QFS + n);
+            spr[n] = qc(i, j, k, QFS + n);
+          }
+          const amrex::Real cavg =
+            0.5 * (qa(i, j, k, QC) + qa(i - 1, j, k, QC));
+          amrex::Real flux_tmp[NVAR] = {0.0};
+          amrex::Real ustar = 0.0, qint_iu = 0.0, tmp1 = 0.0, tmp2 = 0.0,
+                      tmp3 = 0.0, tmp4 = 0.0;
+          riemann(
+            qc(i - 1, j, k, QRHO), qc(i - 1, j, k, QU), qc(i - 1, j, k, QV),
+            qc(i - 1, j, k, QW), qc(i - 1, j, k, QPRES), spl, qc(i, j, k, QRHO),
+            qc(i, j, k, QU), qc(i, j, k, QV), qc(i, j, k, QW),
+            qc(i, j, k, QPRES), spr, 1, cavg, ustar, flux_tmp[URHO],
+            &flux_tmp[UFS], flux_tmp[UMX], flux_tmp[UMY], flux_tmp[UMZ],
+            flux_tmp[UEDEN], flux_tmp[UEINT], qint_iu, tmp1, tmp2, tmp3, tmp4);
+          for (int n = 0; n < NVAR; n++) {
+            flx(i, j, k, n) = flux_tmp[n];
+          }
+        });
+
+    } else if (kernel == "mol_flux") {
+      const amrex::GpuArray<amrex::Array4<amrex::Real>, AMREX_SPACEDIM> flx{
+        {AMREX_D_DECL(
+          m_flux[0].array(mfi), m_flux[1].array(mfi), m_flux[2].array(mfi))}};
+      const amrex::GpuArray<
+        const amrex::Array4<const amrex::Real>, AMREX_SPACEDIM>
+        area{{AMREX_D_DECL(
+          m_area[0].const_array(mfi), m_area[1].const_array(mfi),
+          m_area[2].const_array(mfi))}};
+      pc_compute_hyp_mol_flux(
+        bx, m_q.const_array(mfi), m_qaux.const_array(mfi), flx, area, 2, false,
+        m_flags.const_array(mfi));
+
+    } else if (kernel == "umdrv") {
+      const amrex::GpuArray<const amrex::Array4<amrex::Real>, AMREX_SPACEDIM>
+        flx{{AMREX_D_DECL(
+          m_flux[0].array(mfi), m_flux[1].array(mfi), m_flux[2].array(mfi))}};
+      const amrex::GpuArray<
+        const amrex::Array4<const amrex::Real>, AMREX_SPACEDIM>
+        area{{AMREX_D_DECL(
+          m_area[0].const_array(mfi), m_area[1].const_array(mfi),
+          m_area[2].const_array(mfi))}};
+      const int bc[AMREX_SPACEDIM] = {AMREX_D_DECL(0, 0, 0)};
+      const int* domlo = m_geom.Domain().loVect();
+      const int* domhi = m_geom.Domain().hiVect();
+      pc_umdrv(
+        0.0, bx, domlo, domhi, bc, bc, s, m_dudt.array(mfi),
+        m_q.const_array(mfi), m_qaux.const_array(mfi),
+        m_srcq.const_array(mfi), m_geom.CellSizeArray(), 1.0e-8, 1, 2, true,
+        false, 1, 0.1, flx, area, m_vol.array(mfi), 0.0);
+
+    } else if (kernel == "react") {
+      auto const& rhoY = m_react_state.array(mfi);
+      auto const& T = m_react_state.array(mfi, NUM_SPECIES);
+      auto const& rhoE = m_react_state.array(mfi, NUM_SPECIES + 1);
+      auto const& frcExt = m_react_src.array(mfi);
+      auto const& frcEExt = m_react_src.array(mfi, NUM_SPECIES);
+      auto const& fc = m_fct_count.array(mfi);
+      auto const& mask = m_mask.array(mfi);
+      amrex::ParallelFor(
+        bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          for (int n = 0; n < NUM_SPECIES; ++n) {
+            rhoY(i, j, k, n) = s(i, j, k, UFS + n);
+            frcExt(i, j, k, n) = 0.0;
+          }
+          T(i, j, k) = s(i, j, k, UTEMP);
+          rhoE(i, j, k) = s(i, j, k, UEINT);
+          frcEExt(i, j, k) = 0.0;
+        });
+      amrex::Real current_time = 0.0;
+      m_reactor->react(
+        bx, rhoY, frcExt, T, rhoE, frcEExt, fc, mask, 1.0e-7, current_time
+#ifdef AMREX_USE_GPU
+        ,
+        amrex::Gpu::gpuStream()
+#endif
+      );
+
+    } else {
+      amrex::Abort("Unknown benchmark kernel " + kernel);
+    }
+  }
+  amrex::Gpu::synchronize();
+}
+
+} // namespace pelec_bench
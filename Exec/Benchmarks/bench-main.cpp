@@ -0,0 +1,107 @@
+/** \file bench-main.cpp
+ *  Entry point for the kernel micro-benchmarks
+ *
+ *  Runs the kernels of KernelBench on single boxes of the sizes given by
+ *  bench.box_sizes, for every tile size in bench.tile_sizes (0 disables
+ *  tiling) and, with OpenMP, every thread count in bench.num_threads. Each
+ *  result line reports the time per call, the throughput in cells per second
+ *  and the estimated memory traffic per cell and bandwidth.
+ */
+
+#include <fstream>
+#include <iomanip>
+
+#ifdef AMREX_USE_OMP
+#include <omp.h>
+#endif
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Print.H>
+
+#include "bench-kernels.H"
+
+// Necessary as it's used in other source files
+std::string inputs_name;
+
+int
+main(int argc, char* argv[])
+{
+  amrex::Initialize(argc, argv);
+  {
+    amrex::ParmParse pp("bench");
+
+    amrex::Vector<std::string> kernels = pelec_bench::KernelBench::kernels();
+    pp.queryarr("kernels", kernels);
+    amrex::Vector<int> box_sizes{16, 32, 64};
+    pp.queryarr("box_sizes", box_sizes);
+    amrex::Vector<int> tile_sizes{0};
+    pp.queryarr("tile_sizes", tile_sizes);
+    amrex::Vector<int> num_threads{1};
+#ifdef AMREX_USE_OMP
+    num_threads[0] = omp_get_max_threads();
+#endif
+    pp.queryarr("num_threads", num_threads);
+    int nrep = 10;
+    pp.query("nrep", nrep);
+    std::string chem_integrator = "ReactorCvode";
+    pp.query("chem_integrator", chem_integrator);
+    std::string csv_file;
+    pp.query("csv_file", csv_file);
+
+    std::ofstream csv;
+    if (!csv_file.empty() && amrex::ParallelDescriptor::IOProcessor()) {
+      csv.open(csv_file);
+      csv << "kernel,mechanism,box_size,tile_size,threads,seconds,cells_per_s,"
+             "bytes_per_cell,bytes_per_s"
+          << std::endl;
+    }
+
+    amrex::Print() << "PeleC kernel benchmarks: NUM_SPECIES = " << NUM_SPECIES
+                   << ", NVAR = " << NVAR << ", " << AMREX_SPACEDIM << "D"
+                   << std::endl;
+    amrex::Print() << std::left << std::setw(36) << "benchmark"
+                   << std::right << std::setw(14) << "time/call [s]"
+                   << std::setw(14) << "cells/s" << std::setw(12)
+                   << "bytes/cell" << std::setw(12) << "GB/s" << std::endl;
+
+    for (const int box_size : box_sizes) {
+      pelec_bench::KernelBench bench(box_size, chem_integrator);
+      const auto ncells = static_cast<amrex::Real>(bench.numCells());
+      for (const int tile : tile_sizes) {
+        const amrex::IntVect tile_size(tile > 0 ? tile : 1024000);
+        for (const int nthreads : num_threads) {
+#ifdef AMREX_USE_OMP
+          omp_set_num_threads(nthreads);
+#endif
+          for (const auto& kernel : kernels) {
+            const amrex::Real seconds = bench.run(kernel, tile_size, nrep);
+            const amrex::Real bytes =
+              pelec_bench::KernelBench::bytesPerCell(kernel);
+            const amrex::Real cells_per_s = ncells / seconds;
+
+            const std::string name = kernel + "/" + std::to_string(box_size) +
+                                     "/tile:" + std::to_string(tile) +
+                                     "/threads:" + std::to_string(nthreads);
+            amrex::Print() << std::left << std::setw(36) << name << std::right
+                           << std::scientific << std::setprecision(4)
+                           << std::setw(14) << seconds << std::setw(14)
+                           << cells_per_s << std::fixed << std::setprecision(0)
+                           << std::setw(12) << bytes << std::setprecision(2)
+                           << std::setw(12) << cells_per_s * bytes * 1.0e-9
+                           << std::endl;
+            if (csv.is_open()) {
+              csv << kernel << "," << PELE_BENCHMARK_MECHANISM << ","
+                  << box_size << "," << tile << "," << nthreads << ","
+                  << seconds << "," << cells_per_s << "," << bytes << ","
+                  << cells_per_s * bytes << std::endl;
+            }
+          }
+        }
+      }
+    }
+  }
+  amrex::Finalize();
+
+  return 0;
+}
@@ -162,12 +162,13 @@ amrex_probinit(
       PeleC::prob_parm_host->h_xarray[i] = PeleC::prob_parm_host->h_xinput[i];
     }
     PeleC::prob_parm_host->h_xdiff.resize(nx);
-    PeleC::prob_parm_host->xdiff.resize(nx);
     std::adjacent_difference(
       PeleC::prob_parm_host->h_xarray.begin(),
       PeleC::prob_parm_host->h_xarray.end(),
       PeleC::prob_parm_host->h_xdiff.begin());
     PeleC::prob_parm_host->h_xdiff[0] = PeleC::prob_parm_host->h_xdiff[1];
+    PeleC::h_prob_parm_device->xaxis.define(
+      PeleC::prob_parm_host->h_xarray.data(), static_cast<int>(nx));
 
     // Dimensions of the input box.
     PeleC::h_prob_parm_device->Linput =
@@ -195,9 +196,6 @@ amrex_probinit(
     amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xarray.begin(),
     PeleC::prob_parm_host->h_xarray.end(),
     PeleC::prob_parm_host->xarray.begin());
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xdiff.begin(),
-    PeleC::prob_parm_host->h_xdiff.end(), PeleC::prob_parm_host->xdiff.begin());
 
   // Get pointers to the data
   PeleC::h_prob_parm_device->d_xinput = PeleC::prob_parm_host->xinput.data();
@@ -205,7 +203,6 @@ amrex_probinit(
   PeleC::h_prob_parm_device->d_vinput = PeleC::prob_parm_host->vinput.data();
   PeleC::h_prob_parm_device->d_winput = PeleC::prob_parm_host->winput.data();
   PeleC::h_prob_parm_device->d_xarray = PeleC::prob_parm_host->xarray.data();
-  PeleC::h_prob_parm_device->d_xdiff = PeleC::prob_parm_host->xdiff.data();
 }
 }
 
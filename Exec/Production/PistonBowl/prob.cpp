@@ -26,6 +26,9 @@ ReadPipeInflow(const std::string iname)
   PeleC::h_prob_parm_device->timeInflowMax = *std::max_element(
     PeleC::prob_parm_host->h_timeInput.begin(),
     PeleC::prob_parm_host->h_timeInput.end());
+  PeleC::h_prob_parm_device->timeAxis.define(
+    PeleC::prob_parm_host->h_timeInput.data(),
+    PeleC::h_prob_parm_device->inflowNtime);
 
   // Radial grid
   PeleC::prob_parm_host->rInput.resize(PeleC::h_prob_parm_device->nr + 1, 0.0);
@@ -39,6 +42,8 @@ ReadPipeInflow(const std::string iname)
       PeleC::prob_parm_host->rInput[i + 1] * 0.5 +
       PeleC::prob_parm_host->rInput[i] * 0.5;
   }
+  PeleC::h_prob_parm_device->rAxis.define(
+    PeleC::prob_parm_host->h_rM.data(), PeleC::h_prob_parm_device->nr);
 
   // Azimuthal grid
   PeleC::prob_parm_host->thetaInput.resize(
@@ -56,6 +61,8 @@ ReadPipeInflow(const std::string iname)
   PeleC::h_prob_parm_device->thetaMax = *std::max_element(
     PeleC::prob_parm_host->h_thetaM.begin(),
     PeleC::prob_parm_host->h_thetaM.end());
+  PeleC::h_prob_parm_device->thetaAxis.define(
+    PeleC::prob_parm_host->h_thetaM.data(), PeleC::h_prob_parm_device->nt);
 
   // Read in velocities
   PeleC::prob_parm_host->h_Uz.resize(
@@ -281,12 +288,13 @@ amrex_probinit(
       PeleC::prob_parm_host->h_xarray[i] = PeleC::prob_parm_host->h_xinput[i];
     }
     PeleC::prob_parm_host->h_xdiff.resize(nx);
-    PeleC::prob_parm_host->xdiff.resize(nx);
     std::adjacent_difference(
       PeleC::prob_parm_host->h_xarray.begin(),
       PeleC::prob_parm_host->h_xarray.end(),
       PeleC::prob_parm_host->h_xdiff.begin());
     PeleC::prob_parm_host->h_xdiff[0] = PeleC::prob_parm_host->h_xdiff[1];
+    PeleC::h_prob_parm_device->xaxis.define(
+      PeleC::prob_parm_host->h_xarray.data(), static_cast<int>(nx));
 
     // Dimensions of the input box.
     PeleC::h_prob_parm_device->Linput =
@@ -339,9 +347,6 @@ amrex_probinit(
     amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xarray.begin(),
     PeleC::prob_parm_host->h_xarray.end(),
     PeleC::prob_parm_host->xarray.begin());
-  amrex::Gpu::copy(
-    amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xdiff.begin(),
-    PeleC::prob_parm_host->h_xdiff.end(), PeleC::prob_parm_host->xdiff.begin());
 
   // Get pointers to the data
   PeleC::h_prob_parm_device->d_timeInput =
@@ -356,7 +361,6 @@ amrex_probinit(
   PeleC::h_prob_parm_device->d_vinput = PeleC::prob_parm_host->vinput.data();
   PeleC::h_prob_parm_device->d_winput = PeleC::prob_parm_host->winput.data();
   PeleC::h_prob_parm_device->d_xarray = PeleC::prob_parm_host->xarray.data();
-  PeleC::h_prob_parm_device->d_xdiff = PeleC::prob_parm_host->xdiff.data();
 }
 }
 
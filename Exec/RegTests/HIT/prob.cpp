@@ -147,6 +147,8 @@ amrex_probinit(
       PeleC::prob_parm_host->h_xarray.end(),
       PeleC::prob_parm_host->h_xdiff.begin());
     PeleC::prob_parm_host->h_xdiff[0] = PeleC::prob_parm_host->h_xdiff[1];
+    PeleC::h_prob_parm_device->xaxis.define(
+      PeleC::prob_parm_host->h_xarray.data(), static_cast<int>(nx));
 
     // Make sure the search array is increasing
     if (!std::is_sorted(
@@ -166,7 +168,6 @@ amrex_probinit(
       PeleC::prob_parm_host->h_winput.size());
     PeleC::prob_parm_host->xarray.resize(
       PeleC::prob_parm_host->h_xarray.size());
-    PeleC::prob_parm_host->xdiff.resize(PeleC::prob_parm_host->h_xdiff.size());
     amrex::Gpu::copy(
       amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xinput.begin(),
       PeleC::prob_parm_host->h_xinput.end(),
@@ -187,17 +188,12 @@ amrex_probinit(
       amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xarray.begin(),
       PeleC::prob_parm_host->h_xarray.end(),
       PeleC::prob_parm_host->xarray.begin());
-    amrex::Gpu::copy(
-      amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_xdiff.begin(),
-      PeleC::prob_parm_host->h_xdiff.end(),
-      PeleC::prob_parm_host->xdiff.begin());
 
     PeleC::h_prob_parm_device->d_xinput = PeleC::prob_parm_host->xinput.data();
     PeleC::h_prob_parm_device->d_uinput = PeleC::prob_parm_host->uinput.data();
     PeleC::h_prob_parm_device->d_vinput = PeleC::prob_parm_host->vinput.data();
     PeleC::h_prob_parm_device->d_winput = PeleC::prob_parm_host->winput.data();
     PeleC::h_prob_parm_device->d_xarray = PeleC::prob_parm_host->xarray.data();
-    PeleC::h_prob_parm_device->d_xdiff = PeleC::prob_parm_host->xdiff.data();
 
     // Dimensions of the input box.
     PeleC::h_prob_parm_device->Linput =
@@ -135,6 +135,9 @@ read_pmf(const std::string& myfile)
     }
   }
 
+  PeleC::h_prob_parm_device->pmf_axis.define(
+    PeleC::prob_parm_host->h_pmf_X.data(), PeleC::h_prob_parm_device->pmf_N);
+
   amrex::Gpu::copy(
     amrex::Gpu::hostToDevice, PeleC::prob_parm_host->h_pmf_X.begin(),
     PeleC::prob_parm_host->h_pmf_X.end(), PeleC::prob_parm_host->pmf_X.begin());
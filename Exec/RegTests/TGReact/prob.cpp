@@ -70,6 +70,8 @@ amrex_probinit(
       PeleC::prob_parm_host->h_xarray.end(),
       PeleC::prob_parm_host->h_dxinput.begin());
     PeleC::prob_parm_host->h_dxinput[0] = PeleC::prob_parm_host->h_dxinput[1];
+    PeleC::h_prob_parm_device->xaxis.define(
+      PeleC::prob_parm_host->h_xarray.data(), PeleC::h_prob_parm_device->nx);
 
     // Get pointer to the data
     PeleC::prob_parm_host->input.resize(PeleC::prob_parm_host->h_input.size());
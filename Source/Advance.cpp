@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <array>
+
 #include "mechanism.H"
 
 #include "PeleC.H"
@@ -7,6 +10,27 @@
 #include "SprayParticles.H"
 #endif
 
+namespace {
+// Split the components of a fill into ranges of consecutive components that
+// need the same number of ghost cells, dropping the ones that are not needed
+amrex::Vector<std::array<int, 3>>
+Sborder_fill_ranges(const amrex::Vector<int>& fill_ng)
+{
+  amrex::Vector<std::array<int, 3>> ranges; // {scomp, ncomp, ng}
+  int n = 0;
+  while (n < fill_ng.size()) {
+    const int scomp = n;
+    while ((n < fill_ng.size()) && (fill_ng[n] == fill_ng[scomp])) {
+      ++n;
+    }
+    if (fill_ng[scomp] > 0) {
+      ranges.push_back({scomp, n - scomp, fill_ng[scomp]});
+    }
+  }
+  return ranges;
+}
+} // namespace
+
 amrex::Real
 PeleC::advance(
   amrex::Real time, amrex::Real dt, int amr_iteration, int amr_ncycle)
@@ -32,6 +56,8 @@ PeleC::advance(
     }
   }
 
+  Sborder_fillpatcher_ng = -1;
+
   amrex::Real dt_new;
   if (do_mol) {
     dt_new = do_mol_advance(time, dt, amr_iteration, amr_ncycle);
@@ -53,7 +79,10 @@ PeleC::do_mol_advance(
   // into MOL advance yet");
 
   for (int i = 0; i < num_state_type; ++i) {
-    if ((i != Reactions_Type) || (!do_react)) {
+    if (i == Stats_Type) {
+      // Only accumulated in place, so keep the data but advance its time
+      state[i].setNewTimeLevel(time + dt);
+    } else if ((i != Reactions_Type) || (!do_react)) {
       state[i].allocOldData();
       state[i].swapTimeLevels(dt);
     }
@@ -66,7 +95,11 @@ PeleC::do_mol_advance(
   amrex::MultiFab& S_old = get_old_data(State_Type);
   amrex::MultiFab& S_new = get_new_data(State_Type);
 
-  amrex::MultiFab molSrc(grids, dmap, NVAR, 0, amrex::MFInfo(), Factory());
+  // With a deep halo, the predictor is also evaluated on the ghost cells
+  // needed by the corrector, so that U^* does not need to be exchanged
+  const int ng_halo = nGrowDeepHalo();
+  amrex::MultiFab molSrc(
+    grids, dmap, NVAR, ng_halo, amrex::MFInfo(), Factory());
 
   amrex::MultiFab molSrc_old;
   amrex::MultiFab molSrc_new;
@@ -74,6 +107,10 @@ PeleC::do_mol_advance(
     molSrc_old.define(grids, dmap, NVAR, 0, amrex::MFInfo(), Factory());
     molSrc_new.define(grids, dmap, NVAR, 0, amrex::MFInfo(), Factory());
   }
+  pele::Telemetry::ScopedMemory telemetry_memory(
+    pele::Telemetry::mem_mol, pele::Telemetry::bytes(molSrc) +
+                                pele::Telemetry::bytes(molSrc_old) +
+                                pele::Telemetry::bytes(molSrc_new));
 
   if (!do_react) {
     get_new_data(Reactions_Type).setVal(0.0);
@@ -88,24 +125,42 @@ PeleC::do_mol_advance(
     amrex::Print() << "... Computing MOL source term at t^{n} " << std::endl;
   }
 
-  int nGrow_FP_border = numGrow() + nGrowF;
+  // The MOL update reads every component of Sborder, the sprays only need the
+  // gas state up to the species but possibly on more ghost cells
+  amrex::Vector<int> fill_ng(NVAR, 0);
+  require_Sborder_comps(fill_ng, 0, NVAR, numGrow() + nGrowF + ng_halo);
+  if (use_dynamic_les()) {
+    require_Sborder_comps(fill_ng, 0, NVAR, nGrowDLES);
+  }
 #ifdef PELE_USE_SPRAY
-  const int spray_state_ghosts = sprayStateGhosts(amr_ncycle);
-  nGrow_FP_border = amrex::max(nGrow_FP_border, spray_state_ghosts);
-  AMREX_ASSERT(Sborder.nGrow() >= nGrow_FP_border);
+  if (do_spray_particles) {
+    require_Sborder_comps(
+      fill_ng, 0, UFS + NUM_SPECIES, sprayStateGhosts(amr_ncycle));
+  }
 #endif
 
-  FillPatcherFill(Sborder, 0, NVAR, nGrow_FP_border, time, State_Type, 0);
+  fill_Sborder_begin(time, fill_ng);
+
+  // Build the sources that do not read Sborder while it is being filled
+  for (int src : src_list) {
+    if (build_source_during_fill(src)) {
+      construct_old_source(src, time, dt, amr_iteration, amr_ncycle, 0, 0);
+    }
+  }
+
+  fill_Sborder_finish(time, fill_ng);
   amrex::Real reflux_factor = 0.5;
-  getMOLSrcTerm(Sborder, molSrc, time, dt, reflux_factor);
+  getMOLSrcTerm(Sborder, molSrc, time, dt, reflux_factor, ng_halo);
 
   // Build other (non-diffusion) sources at t_old
   for (int src : src_list) {
     if (src != diff_src) {
-      construct_old_source(src, time, dt, amr_iteration, amr_ncycle, 0, 0);
+      if (!build_source_during_fill(src)) {
+        construct_old_source(src, time, dt, amr_iteration, amr_ncycle, 0, 0);
+      }
 
       // add sources to molsrc
-      amrex::MultiFab::Saxpy(molSrc, 1.0, *old_sources[src], 0, 0, NVAR, 0);
+      saxpy_source(molSrc, 1.0, *old_sources[src], src, ng_halo);
     }
   }
 
@@ -129,17 +184,32 @@ PeleC::do_mol_advance(
     amrex::Print() << "... Computing MOL source term at t^{n+1} " << std::endl;
   }
 
-  FillPatcherFill(Sborder, 0, NVAR, nGrow_FP_border, time + dt, State_Type, 0);
+  if (use_deep_halo()) {
+    advance_Sborder_halo(molSrc, time + dt, dt);
+  } else {
+    fill_Sborder_begin(time + dt, fill_ng);
+  }
+
+  for (int src : src_list) {
+    if (build_source_during_fill(src)) {
+      construct_new_source(src, time + dt, dt, amr_iteration, amr_ncycle, 0, 0);
+    }
+  }
+
+  fill_Sborder_finish(time + dt, fill_ng);
   reflux_factor = mol_iters > 1 ? 0 : 0.5;
   getMOLSrcTerm(Sborder, molSrc, time, dt, reflux_factor);
 
   // Build other (non-diffusion) sources at t_new
   for (int src : src_list) {
     if (src != diff_src) {
-      construct_new_source(src, time + dt, dt, amr_iteration, amr_ncycle, 0, 0);
+      if (!build_source_during_fill(src)) {
+        construct_new_source(
+          src, time + dt, dt, amr_iteration, amr_ncycle, 0, 0);
+      }
 
       // add sources to molsrc
-      amrex::MultiFab::Saxpy(molSrc, 1.0, *new_sources[src], 0, 0, NVAR, 0);
+      saxpy_source(molSrc, 1.0, *new_sources[src], src, 0);
     }
   }
 
@@ -174,8 +244,8 @@ PeleC::do_mol_advance(
                        << mol_iter << " of " << mol_iters << ")" << std::endl;
       }
 
-      FillPatcherFill(
-        Sborder, 0, NVAR, nGrow_FP_border, time + dt, State_Type, 0);
+      fill_Sborder_begin(time + dt, fill_ng);
+      fill_Sborder_finish(time + dt, fill_ng);
       reflux_factor = mol_iter == mol_iters ? 0.5 : 0;
       getMOLSrcTerm(Sborder, molSrc_new, time, dt, reflux_factor);
 
@@ -210,7 +280,7 @@ PeleC::do_sdc_advance(
 
   initialize_sdc_advance(time, dt, amr_iteration, amr_ncycle);
 
-  if (do_react_load_balance) {
+  if (do_mol_load_balance || do_react_load_balance) {
     get_new_data(Work_Estimate_Type).setVal(0.0);
   }
 
@@ -250,36 +320,54 @@ PeleC::do_sdc_iteration(
   initialize_sdc_iteration(
     time, dt, amr_iteration, amr_ncycle, sub_iteration, sub_ncycle);
 
-  // Create Sborder if hydro or diffuse, with the appropriate number of grow
-  // cells
-  int nGrow_FP_border = 0;
+  // Fill Sborder if hydro, diffuse, dynamic LES or sprays, with the components
+  // and number of grow cells each of them reads
+  amrex::Vector<int> fill_ng(NVAR, 0);
   bool fill_Sborder = false;
 
   if (do_hydro) {
     fill_Sborder = true;
-    nGrow_FP_border = numGrow() + nGrowF;
+    require_Sborder_comps(fill_ng, 0, NVAR, numGrow() + nGrowF);
   } else if (do_diffuse) {
     fill_Sborder = true;
-    nGrow_FP_border = numGrow();
+    require_Sborder_comps(fill_ng, 0, NVAR, numGrow());
+  }
+  if (use_dynamic_les()) {
+    fill_Sborder = true;
+    require_Sborder_comps(fill_ng, 0, NVAR, nGrowDLES);
   }
 #ifdef PELE_USE_SPRAY
+  const int spray_state_ghosts = sprayStateGhosts(amr_ncycle);
   if (do_spray_particles) {
-    const int spray_state_ghosts = sprayStateGhosts(amr_ncycle);
     fill_Sborder = true;
-    nGrow_FP_border = amrex::max(nGrow_FP_border, spray_state_ghosts);
-    AMREX_ASSERT(Sborder.nGrow() >= nGrow_FP_border);
+    require_Sborder_comps(fill_ng, 0, UFS + NUM_SPECIES, spray_state_ghosts);
   }
 #endif
 
   if (fill_Sborder) {
-    FillPatcherFill(Sborder, 0, NVAR, nGrow_FP_border, time, State_Type, 0);
+    fill_Sborder_begin(time, fill_ng);
+  }
+
+  if (sub_iteration == 0) {
+
+    // Build the sources that do not read Sborder while it is being filled
+    for (int n : src_list) {
+      if (build_source_during_fill(n)) {
+        construct_old_source(
+          n, time, dt, amr_iteration, amr_ncycle, sub_iteration, sub_ncycle);
+      }
+    }
+  }
+
+  if (fill_Sborder) {
+    fill_Sborder_finish(time, fill_ng);
   }
 
   if (sub_iteration == 0) {
 
     // Build other (non-diffusion) sources at t_old
     for (int n : src_list) {
-      if (n != diff_src) {
+      if ((n != diff_src) && (!build_source_during_fill(n))) {
         construct_old_source(
           n, time, dt, amr_iteration, amr_ncycle, sub_iteration, sub_ncycle);
       }
@@ -302,7 +390,8 @@ PeleC::do_sdc_iteration(
     // Initialize sources at t_new by copying from t_old
     for (int src : src_list) {
       amrex::MultiFab::Copy(
-        *new_sources[src], *old_sources[src], 0, 0, NVAR, 0);
+        *new_sources[src], *old_sources[src], 0, 0,
+        old_sources[src]->nComp(), 0);
     }
   }
 
@@ -320,12 +409,35 @@ PeleC::do_sdc_iteration(
 
   // Now update t_new sources (diffusion separate because it requires a fill
   // patch)
-  if (do_diffuse || do_spray_particles) {
-    int nGrowDiff = numGrow();
-    if (do_spray_particles && level > 0) {
-      nGrowDiff = amrex::max(nGrowDiff, nGrow_FP_border);
+  const bool fill_Sborder_new =
+    do_diffuse || do_spray_particles || use_dynamic_les();
+  amrex::Vector<int> fill_ng_new(NVAR, 0);
+  if (do_diffuse) {
+    require_Sborder_comps(fill_ng_new, 0, NVAR, numGrow());
+  }
+  if (use_dynamic_les()) {
+    require_Sborder_comps(fill_ng_new, 0, NVAR, nGrowDLES);
+  }
+#ifdef PELE_USE_SPRAY
+  if (do_spray_particles) {
+    const int nGrowSpray =
+      level > 0 ? amrex::max(numGrow(), spray_state_ghosts) : numGrow();
+    require_Sborder_comps(fill_ng_new, 0, UFS + NUM_SPECIES, nGrowSpray);
+  }
+#endif
+  if (fill_Sborder_new) {
+    fill_Sborder_begin(time + dt, fill_ng_new);
+  }
+
+  for (int n : src_list) {
+    if (build_source_during_fill(n)) {
+      construct_new_source(
+        n, time + dt, dt, amr_iteration, amr_ncycle, sub_iteration, sub_ncycle);
     }
-    FillPatcherFill(Sborder, 0, NVAR, nGrowDiff, time + dt, State_Type, 0);
+  }
+
+  if (fill_Sborder_new) {
+    fill_Sborder_finish(time + dt, fill_ng_new);
   }
   if (do_diffuse) {
     if (verbose != 0) {
@@ -338,7 +450,7 @@ PeleC::do_sdc_iteration(
 
   // Build other (non-diffusion) sources at t_new
   for (int n : src_list) {
-    if (n != diff_src) {
+    if ((n != diff_src) && (!build_source_during_fill(n))) {
       construct_new_source(
         n, time + dt, dt, amr_iteration, amr_ncycle, sub_iteration, sub_ncycle);
     }
@@ -368,8 +480,8 @@ PeleC::construct_Snew(
 
   amrex::MultiFab::Copy(S_new, S_old, 0, 0, NVAR, ng);
   for (int src : src_list) {
-    amrex::MultiFab::Saxpy(S_new, 0.5 * dt, *new_sources[src], 0, 0, NVAR, ng);
-    amrex::MultiFab::Saxpy(S_new, 0.5 * dt, *old_sources[src], 0, 0, NVAR, ng);
+    saxpy_source(S_new, 0.5 * dt, *new_sources[src], src, ng);
+    saxpy_source(S_new, 0.5 * dt, *old_sources[src], src, ng);
   }
   if (do_hydro) {
     amrex::MultiFab::Saxpy(S_new, dt, hydro_source, 0, 0, NVAR, ng);
@@ -382,6 +494,140 @@ PeleC::construct_Snew(
   }
 }
 
+void
+PeleC::require_Sborder_comps(
+  amrex::Vector<int>& fill_ng, int scomp, int ncomp, int ng)
+{
+  AMREX_ASSERT(scomp >= 0 && scomp + ncomp <= fill_ng.size());
+  for (int n = scomp; n < scomp + ncomp; ++n) {
+    fill_ng[n] = amrex::max(fill_ng[n], ng);
+  }
+}
+
+void
+PeleC::fill_Sborder_begin(amrex::Real time, const amrex::Vector<int>& fill_ng)
+{
+  BL_PROFILE("PeleC::fill_Sborder_begin()");
+  pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::fillpatch);
+
+  AMREX_ASSERT(!Sborder_fill_pending);
+  AMREX_ASSERT(fill_ng.size() == NVAR);
+
+  const auto ranges = Sborder_fill_ranges(fill_ng);
+  if (ranges.empty()) {
+    return;
+  }
+  const int ng = *std::max_element(fill_ng.begin(), fill_ng.end());
+  AMREX_ASSERT(Sborder.nGrow() >= ng);
+
+  // The physical BCs and the coarse-fine interpolation work on the whole
+  // state, so only the exchanges between boxes are split into ranges
+  if (level > 0) {
+    // The FillPatcher is built by the first fill of the step for its number
+    // of ghost cells, so the later fills cannot be deeper
+    if (Sborder_fillpatcher_ng < 0) {
+      Sborder_fillpatcher_ng = ng;
+    }
+    AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
+      ng <= Sborder_fillpatcher_ng,
+      "Sborder fill deeper than the first fill of the step");
+    FillPatcherFill(Sborder, 0, NVAR, ng, time, State_Type, 0);
+    return;
+  }
+
+  amrex::Vector<amrex::MultiFab*> smf;
+  amrex::Vector<amrex::Real> stime;
+  state[State_Type].getData(smf, stime, time);
+
+  if (smf.size() == 1) {
+    amrex::MultiFab::Copy(Sborder, *smf[0], 0, 0, NVAR, 0);
+  } else {
+    AMREX_ASSERT(smf.size() == 2);
+    const amrex::Real alpha = (stime[1] - time) / (stime[1] - stime[0]);
+    amrex::MultiFab::LinComb(
+      Sborder, alpha, *smf[0], 0, 1.0 - alpha, *smf[1], 0, 0, NVAR, 0);
+  }
+
+  // Only one exchange can be in flight, so all but the last range are
+  // exchanged right away
+  const int nranges = static_cast<int>(ranges.size());
+  const int nblocking = overlap_fill_sources ? nranges - 1 : nranges;
+  for (int i = 0; i < nblocking; ++i) {
+    Sborder.FillBoundary(
+      ranges[i][0], ranges[i][1], amrex::IntVect(ranges[i][2]),
+      geom.periodicity());
+  }
+  if (overlap_fill_sources) {
+    const auto& last = ranges.back();
+    Sborder.FillBoundary_nowait(
+      last[0], last[1], amrex::IntVect(last[2]), geom.periodicity());
+    Sborder_fill_pending = true;
+    return;
+  }
+
+  amrex::StateDataPhysBCFunct physbcf(state[State_Type], 0, geom);
+  physbcf(Sborder, 0, NVAR, amrex::IntVect(ng), time, 0);
+}
+
+void
+PeleC::fill_Sborder_finish(
+  amrex::Real time, const amrex::Vector<int>& fill_ng)
+{
+  BL_PROFILE("PeleC::fill_Sborder_finish()");
+  pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::fillpatch);
+
+  if (!Sborder_fill_pending) {
+    return;
+  }
+
+  Sborder.FillBoundary_finish();
+  Sborder_fill_pending = false;
+
+  const int ng = *std::max_element(fill_ng.begin(), fill_ng.end());
+  amrex::StateDataPhysBCFunct physbcf(state[State_Type], 0, geom);
+  physbcf(Sborder, 0, NVAR, amrex::IntVect(ng), time, 0);
+}
+
+void
+PeleC::advance_Sborder_halo(
+  const amrex::MultiFab& molSrc, amrex::Real time, amrex::Real dt)
+{
+  BL_PROFILE("PeleC::advance_Sborder_halo()");
+
+  // Advance Sborder from U^n to U^* on its valid and ghost cells, replacing
+  // the ghost cell exchange of U^*. This matches the update of S_new on the
+  // valid cells.
+  const int ng = molSrc.nGrow();
+  AMREX_ASSERT(Sborder.nGrow() >= ng);
+
+  // Ghost cells outside of the domain are set by the physical BCs instead
+  const amrex::Box pdomain = geom.growPeriodicDomain(ng);
+  auto const& sarrs = Sborder.arrays();
+  auto const& marrs = molSrc.const_arrays();
+  amrex::ParallelFor(
+    Sborder, amrex::IntVect(ng), NVAR,
+    [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+      if (pdomain.contains(amrex::IntVect(AMREX_D_DECL(i, j, k)))) {
+        sarrs[nbx](i, j, k, n) += dt * marrs[nbx](i, j, k, n);
+      }
+    });
+  amrex::Gpu::synchronize();
+
+  computeTemp(Sborder, ng);
+
+  amrex::StateDataPhysBCFunct physbcf(state[State_Type], 0, geom);
+  physbcf(Sborder, 0, NVAR, amrex::IntVect(ng), time, 0);
+}
+
+bool
+PeleC::build_source_during_fill(int src)
+{
+  // Diffusion, spray and the dynamic LES model read Sborder, everything else
+  // only reads the state
+  return overlap_fill_sources && (src != diff_src) && (src != spray_src) &&
+         ((src != les_src) || (!use_dynamic_les()));
+}
+
 void
 PeleC::initialize_sdc_iteration(
   amrex::Real /*time*/,
@@ -419,9 +665,13 @@ PeleC::initialize_sdc_advance(
   BL_PROFILE("PeleC::initialize_sdc_advance()");
 
   for (int i = 0; i < num_state_type; ++i) {
-    state[i].allocOldData();
-    state[i].swapTimeLevels(dt);
+    if (i != Stats_Type) {
+      state[i].allocOldData();
+      state[i].swapTimeLevels(dt);
+    }
   }
+  // Only accumulated in place, so keep the data but advance its time
+  state[Stats_Type].setNewTimeLevel(state[State_Type].curTime());
 
   if (do_react) {
     // Initialize I_R with value from previous time step
@@ -1,3 +1,12 @@
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
 #include <AMReX_FArrayBox.H>
 #include <AMReX_Geometry.H>
 #include <AMReX_PhysBCFunct.H>
@@ -9,9 +18,14 @@ struct PCHypFillExtDir
 {
   ProbParmDevice const* lprobparm;
   bool m_do_turb_inflow{false};
+  // Cached ghost cell values of the low and high faces in each direction,
+  // written by bcnormal if m_store and read instead of calling it if m_load
+  amrex::GpuArray<amrex::Array4<amrex::Real>, 2 * AMREX_SPACEDIM> m_cache{};
+  bool m_store{false};
+  bool m_load{false};
 
   AMREX_GPU_HOST
-  constexpr explicit PCHypFillExtDir(
+  explicit PCHypFillExtDir(
     const ProbParmDevice* d_prob_parm, const bool do_turb_inflow)
     : lprobparm(d_prob_parm), m_do_turb_inflow(do_turb_inflow)
   {
@@ -59,6 +73,12 @@ struct PCHypFillExtDir
     for (int idir = 0; idir < AMREX_SPACEDIM; ++idir) {
       if ((bc[idir] == amrex::BCType::ext_dir) && (iv[idir] < domlo[idir])) {
         // xlo, ylo, [zlo if 3D]
+        if (m_load) {
+          for (int n = 0; n < NVAR; n++) {
+            dest(iv, n) = m_cache[2 * idir](iv, n);
+          }
+          continue;
+        }
 
         // interior state at edge of domain
         amrex::IntVect loc_e{iv};
@@ -90,11 +110,22 @@ struct PCHypFillExtDir
         for (int n = 0; n < NVAR; n++) {
           dest(iv, n) = s_ext[n];
         }
+        if (m_store) {
+          for (int n = 0; n < NVAR; n++) {
+            m_cache[2 * idir](iv, n) = s_ext[n];
+          }
+        }
 
       } else if (
         (bc[idir + AMREX_SPACEDIM] == amrex::BCType::ext_dir) &&
         (iv[idir] > domhi[idir])) {
         // xhi, yhi, [zhi if 3D]
+        if (m_load) {
+          for (int n = 0; n < NVAR; n++) {
+            dest(iv, n) = m_cache[2 * idir + 1](iv, n);
+          }
+          continue;
+        }
 
         // interior state at edge of domain
         amrex::IntVect loc_e{iv};
@@ -126,6 +157,11 @@ struct PCHypFillExtDir
         for (int n = 0; n < NVAR; n++) {
           dest(iv, n) = s_ext[n];
         }
+        if (m_store) {
+          for (int n = 0; n < NVAR; n++) {
+            m_cache[2 * idir + 1](iv, n) = s_ext[n];
+          }
+        }
       }
     }
   }
@@ -148,6 +184,296 @@ struct PCReactFillExtDir
   }
 };
 
+namespace {
+// Ghost cell values of the ext_dir faces of a fill box
+struct BCCacheEntry
+{
+  std::array<std::unique_ptr<amrex::FArrayBox>, 2 * AMREX_SPACEDIM> faces;
+  bool ready{false};
+};
+
+// Level (through its domain), fill box and phase of the boundary values
+using BCCacheKey = std::array<amrex::Long, 4 * AMREX_SPACEDIM + 1>;
+
+std::map<BCCacheKey, BCCacheEntry> bc_cache_entries;
+
+BCCacheKey
+bc_cache_key(
+  const amrex::Box& domain, const amrex::Box& bx, const amrex::Real time)
+{
+  BCCacheKey key;
+  for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+    key[dir] = domain.smallEnd(dir);
+    key[AMREX_SPACEDIM + dir] = domain.bigEnd(dir);
+    key[2 * AMREX_SPACEDIM + dir] = bx.smallEnd(dir);
+    key[3 * AMREX_SPACEDIM + dir] = bx.bigEnd(dir);
+  }
+  amrex::Long phase = 0;
+  if (PeleC::bcCache() == "periodic") {
+    const amrex::Real period = PeleC::bcCachePeriod();
+    amrex::Real frac = std::fmod(time, period) / period;
+    if (frac < 0.0) {
+      frac += 1.0;
+    }
+    // Fills share the entry of the nearest of the bc_cache_nphases phases
+    const amrex::Long nphases = PeleC::bcCacheNPhases();
+    phase = std::llround(frac * nphases) % nphases;
+  }
+  key[4 * AMREX_SPACEDIM] = phase;
+  return key;
+}
+
+// Entry to load the boundary values from (load = true) or to store them into,
+// nullptr if they are not cached
+BCCacheEntry*
+bc_cache_lookup(
+  const amrex::Box& bx,
+  amrex::Geometry const& geom,
+  const amrex::Real time,
+  const amrex::BCRec& bcr,
+  bool& load)
+{
+  load = false;
+  if (PeleC::bcCache() == "none") {
+    return nullptr;
+  }
+
+  const auto key = bc_cache_key(geom.Domain(), bx, time);
+  BCCacheEntry* entry = nullptr;
+  bool created = false;
+#ifdef AMREX_USE_OMP
+#pragma omp critical(pc_bc_cache)
+#endif
+  {
+    auto it = bc_cache_entries.find(key);
+    if (it != bc_cache_entries.end()) {
+      if (it->second.ready) {
+        entry = &it->second;
+        load = true;
+      }
+    } else if (
+      static_cast<int>(bc_cache_entries.size()) <
+      PeleC::bcCacheMaxEntries()) {
+      entry = &bc_cache_entries[key];
+      created = true;
+    }
+  }
+
+  if (created) {
+    const amrex::Box& domain = geom.Domain();
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+      amrex::Box lo_bx(bx);
+      lo_bx.setBig(dir, domain.smallEnd(dir) - 1);
+      if ((bcr.lo(dir) == amrex::BCType::ext_dir) && lo_bx.ok()) {
+        entry->faces[2 * dir] =
+          std::make_unique<amrex::FArrayBox>(lo_bx, NVAR);
+      }
+      amrex::Box hi_bx(bx);
+      hi_bx.setSmall(dir, domain.bigEnd(dir) + 1);
+      if ((bcr.hi(dir) == amrex::BCType::ext_dir) && hi_bx.ok()) {
+        entry->faces[2 * dir + 1] =
+          std::make_unique<amrex::FArrayBox>(hi_bx, NVAR);
+      }
+    }
+  }
+  return entry;
+}
+
+// Turbulent inflow fluctuations of the first ghost layer of a face of a fill
+// box, for the few most recent fill times. An entry is only read once ready,
+// the thread that created it being the one that fills it.
+using TurbCacheKey = std::array<amrex::Long, 4 * AMREX_SPACEDIM + 2>;
+
+struct TurbCacheEntry
+{
+  amrex::FArrayBox fab;
+  std::atomic<bool> ready{false};
+};
+
+std::map<amrex::Real, std::map<TurbCacheKey, std::shared_ptr<TurbCacheEntry>>>
+  turb_cache_entries;
+
+constexpr int turb_cache_ntimes = 8;
+
+// Faces filled with turbulent fluctuations since the last regrid, which are
+// the ones interpolated ahead of time by pc_bcfill_prefetch_turb
+struct TurbFace
+{
+  amrex::Box bndry_bx;
+  amrex::Geometry geom;
+  int dir;
+  amrex::Orientation::Side side;
+};
+
+std::map<TurbCacheKey, TurbFace> turb_faces;
+
+// Guards the entries and faces above, which are shared with the prefetch
+std::mutex turb_cache_mutex;
+
+// TurbInflow is not thread safe, so the caller threads wait for the prefetch
+// before calling it
+std::thread turb_prefetch_worker;
+std::mutex turb_prefetch_mutex;
+
+void
+turb_prefetch_wait()
+{
+  std::lock_guard<std::mutex> lock(turb_prefetch_mutex);
+  if (turb_prefetch_worker.joinable()) {
+    turb_prefetch_worker.join();
+  }
+}
+
+TurbCacheKey
+turb_cache_key(
+  const amrex::Box& bndry_bx,
+  amrex::Geometry const& geom,
+  const int dir,
+  const amrex::Orientation::Side side)
+{
+  TurbCacheKey key;
+  const amrex::Box& domain = geom.Domain();
+  for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+    key[d] = domain.smallEnd(d);
+    key[AMREX_SPACEDIM + d] = domain.bigEnd(d);
+    key[2 * AMREX_SPACEDIM + d] = bndry_bx.smallEnd(d);
+    key[3 * AMREX_SPACEDIM + d] = bndry_bx.bigEnd(d);
+  }
+  key[4 * AMREX_SPACEDIM] = dir;
+  key[4 * AMREX_SPACEDIM + 1] = static_cast<int>(side);
+  return key;
+}
+
+// Entry of a face at a time, created if needed; must hold turb_cache_mutex
+std::shared_ptr<TurbCacheEntry>
+turb_cache_entry(
+  const TurbCacheKey& key,
+  const amrex::Box& bndry_bx,
+  const amrex::Real time,
+  bool& created)
+{
+  auto& entries = turb_cache_entries[time];
+  auto it = entries.find(key);
+  created = (it == entries.end());
+  std::shared_ptr<TurbCacheEntry> entry;
+  if (created) {
+    entry = std::make_shared<TurbCacheEntry>();
+    entry->fab.resize(bndry_bx, AMREX_SPACEDIM);
+    entries[key] = entry;
+  } else {
+    entry = it->second;
+  }
+  // Drop the oldest times other than this one; entries being filled are
+  // kept alive by their filling thread
+  while (static_cast<int>(turb_cache_entries.size()) > turb_cache_ntimes) {
+    auto oldest = turb_cache_entries.begin();
+    if (oldest->first == time) {
+      ++oldest;
+    }
+    turb_cache_entries.erase(oldest);
+  }
+  return entry;
+}
+
+// Add the turbulent fluctuations to the zeroed velocity of the first ghost
+// layer, interpolating the inflow planes only the first time a box is filled
+// at a given time
+void
+add_turb_cached(
+  const amrex::Box& bndry_bx,
+  amrex::FArrayBox& data,
+  amrex::Geometry const& geom,
+  const amrex::Real time,
+  const int dir,
+  const amrex::Orientation::Side side)
+{
+  const auto key = turb_cache_key(bndry_bx, geom, dir, side);
+  std::shared_ptr<TurbCacheEntry> entry;
+  bool created = false;
+  {
+    std::lock_guard<std::mutex> lock(turb_cache_mutex);
+    turb_faces.emplace(key, TurbFace{bndry_bx, geom, dir, side});
+    entry = turb_cache_entry(key, bndry_bx, time, created);
+  }
+
+  if (!created && entry->ready.load(std::memory_order_acquire)) {
+    data.copy<amrex::RunOn::Device>(
+      entry->fab, bndry_bx, 0, bndry_bx, UMX, AMREX_SPACEDIM);
+    return;
+  }
+
+  // The prefetch may be filling this entry
+  turb_prefetch_wait();
+  if (!created && entry->ready.load(std::memory_order_acquire)) {
+    data.copy<amrex::RunOn::Device>(
+      entry->fab, bndry_bx, 0, bndry_bx, UMX, AMREX_SPACEDIM);
+    return;
+  }
+  PeleC::turb_inflow.add_turb(bndry_bx, data, UMX, geom, time, dir, side);
+  if (created) {
+    entry->fab.copy<amrex::RunOn::Device>(
+      data, bndry_bx, UMX, bndry_bx, 0, AMREX_SPACEDIM);
+    amrex::Gpu::streamSynchronize();
+    entry->ready.store(true, std::memory_order_release);
+  }
+  // Otherwise another thread is filling the entry, and the fluctuations
+  // computed here are not kept
+}
+
+// Interpolate the fluctuations of the recorded faces of each level domain at
+// the given time
+void
+prefetch_turb(
+  const amrex::Vector<std::pair<amrex::Box, amrex::Real>>& domain_times)
+{
+  for (const auto& dom_time : domain_times) {
+    amrex::Vector<std::pair<TurbFace, std::shared_ptr<TurbCacheEntry>>> todo;
+    {
+      std::lock_guard<std::mutex> lock(turb_cache_mutex);
+      for (const auto& kf : turb_faces) {
+        if (kf.second.geom.Domain() != dom_time.first) {
+          continue;
+        }
+        bool created = false;
+        auto entry = turb_cache_entry(
+          kf.first, kf.second.bndry_bx, dom_time.second, created);
+        if (created) {
+          todo.emplace_back(kf.second, entry);
+        }
+      }
+    }
+    for (auto& fe : todo) {
+      const TurbFace& f = fe.first;
+      auto& fab = fe.second->fab;
+      fab.setVal<amrex::RunOn::Device>(0.0);
+      PeleC::turb_inflow.add_turb(
+        f.bndry_bx, fab, 0, f.geom, dom_time.second, f.dir, f.side);
+      amrex::Gpu::streamSynchronize();
+      fe.second->ready.store(true, std::memory_order_release);
+    }
+  }
+}
+} // namespace
+
+void
+pc_bcfill_clear_cache()
+{
+  turb_prefetch_wait();
+  std::lock_guard<std::mutex> lock(turb_cache_mutex);
+  bc_cache_entries.clear();
+  turb_cache_entries.clear();
+  turb_faces.clear();
+}
+
+void
+pc_bcfill_prefetch_turb(
+  const amrex::Vector<std::pair<amrex::Box, amrex::Real>>& domain_times)
+{
+  turb_prefetch_wait();
+  std::lock_guard<std::mutex> lock(turb_prefetch_mutex);
+  turb_prefetch_worker = std::thread(prefetch_turb, domain_times);
+}
+
 void
 pc_bcfill_hyp(
   amrex::Box const& bx,
@@ -160,6 +486,10 @@ pc_bcfill_hyp(
   const int bcomp,
   const int scomp)
 {
+  // Boundary values declared independent of time (or periodic) and of the
+  // interior state are computed once per box and then copied
+  bool load = false;
+  BCCacheEntry* entry = bc_cache_lookup(bx, geom, time, bcr[bcomp], load);
 
   if (PeleC::turb_inflow.is_initialized()) {
     for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
@@ -174,8 +504,8 @@ pc_bcfill_hyp(
         data.setVal<amrex::RunOn::Device>(
           0.0, bndryBoxLO_ghost, UMX, AMREX_SPACEDIM);
 
-        PeleC::turb_inflow.add_turb(
-          bndryBoxLO, data, UMX, geom, time, dir, amrex::Orientation::low);
+        add_turb_cached(
+          bndryBoxLO, data, geom, time, dir, amrex::Orientation::low);
       }
 
       auto bndryBoxHI = amrex::Box(amrex::adjCellHi(geom.Domain(), dir) & bx);
@@ -189,16 +519,34 @@ pc_bcfill_hyp(
         data.setVal<amrex::RunOn::Device>(
           0.0, bndryBoxHI_ghost, UMX, AMREX_SPACEDIM);
 
-        PeleC::turb_inflow.add_turb(
-          bndryBoxHI, data, UMX, geom, time, dir, amrex::Orientation::high);
+        add_turb_cached(
+          bndryBoxHI, data, geom, time, dir, amrex::Orientation::high);
       }
     }
   }
 
   const ProbParmDevice* lprobparm = PeleC::d_prob_parm_device;
-  amrex::GpuBndryFuncFab<PCHypFillExtDir> hyp_bndry_func(
-    PCHypFillExtDir{lprobparm, PeleC::turb_inflow.is_initialized()});
+  PCHypFillExtDir fill_ext_dir{
+    lprobparm, PeleC::turb_inflow.is_initialized()};
+  if (entry != nullptr) {
+    for (int f = 0; f < 2 * AMREX_SPACEDIM; ++f) {
+      if (entry->faces[f]) {
+        fill_ext_dir.m_cache[f] = entry->faces[f]->array();
+      }
+    }
+    fill_ext_dir.m_store = !load;
+    fill_ext_dir.m_load = load;
+  }
+  amrex::GpuBndryFuncFab<PCHypFillExtDir> hyp_bndry_func(fill_ext_dir);
   hyp_bndry_func(bx, data, dcomp, numcomp, geom, time, bcr, bcomp, scomp);
+
+  if ((entry != nullptr) && !load) {
+    amrex::Gpu::streamSynchronize();
+#ifdef AMREX_USE_OMP
+#pragma omp critical(pc_bc_cache)
+#endif
+    entry->ready = true;
+  }
 }
 
 void
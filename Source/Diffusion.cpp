@@ -7,9 +7,13 @@ PeleC::getMOLSrcTerm(
   amrex::MultiFab& MOLSrcTerm,
   const amrex::Real /*time*/,
   const amrex::Real dt,
-  const amrex::Real reflux_factor)
+  const amrex::Real reflux_factor,
+  const int ng_halo)
 {
   BL_PROFILE("PeleC::getMOLSrcTerm()");
+  pele::Telemetry::ScopedPhase telemetry_phase(
+    (do_hydro && do_mol) ? pele::Telemetry::hydro
+                         : pele::Telemetry::diffusion);
   if (
     (!diffuse_temp) && (!diffuse_enth) && (!diffuse_spec) && (!diffuse_vel) &&
     (!do_hydro)) {
@@ -42,6 +46,9 @@ PeleC::getMOLSrcTerm(
 
      6. Perform weighted redistribution at the EB
 
+     If ng_halo > 0, the source term is also evaluated on that many ghost
+     cells of MOLSrcTerm, which requires ng_halo additional ghost cells in S.
+
      Extra notes:
 
      A. The face-based transport coefficients that are computed with face-based
@@ -78,7 +85,7 @@ PeleC::getMOLSrcTerm(
   {
     for (amrex::MFIter mfi(MOLSrcTerm, amrex::TilingIfNotGPU()); mfi.isValid();
          ++mfi) {
-      const amrex::Box vbox = mfi.tilebox();
+      const amrex::Box vbox = mfi.growntilebox(ng_halo);
       int ng = numGrow();
       const amrex::Box gbox = amrex::grow(vbox, ng);
       const amrex::Box cbox = amrex::grow(vbox, ng - 1);
@@ -90,8 +97,9 @@ PeleC::getMOLSrcTerm(
       if (typ == amrex::FabType::covered) {
         setV(vbox, NVAR, MOLSrc, 0);
         if (do_mol_load_balance && (cost != nullptr)) {
-          wt = (amrex::ParallelDescriptor::second() - wt) / vbox.d_numPts();
-          (*cost)[mfi].plus<amrex::RunOn::Device>(wt, vbox);
+          const amrex::Box tbox = mfi.tilebox();
+          wt = (amrex::ParallelDescriptor::second() - wt) / tbox.d_numPts();
+          (*cost)[mfi].plus<amrex::RunOn::Device>(wt, tbox);
         }
         continue;
       }
@@ -357,39 +365,20 @@ PeleC::getMOLSrcTerm(
 
         // Filter hydro fluxes
         if (use_explicit_filter) {
-          // Get the hydro term
-          amrex::FArrayBox hydro_flux[AMREX_SPACEDIM];
-          amrex::GpuArray<amrex::Array4<amrex::Real>, AMREX_SPACEDIM>
-            hydro_flux_arr;
+          // Get the hydro term in place of the saved diffusion fluxes
           for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-            hydro_flux[dir].resize(
-              flux_ec[dir].box(), NVAR, amrex::The_Async_Arena());
-            hydro_flux_arr[dir] = hydro_flux[dir].array();
             lincomb_array4(
               flux_ec[dir].box(), Density, NVAR, flx[dir],
-              diffusion_flux_arr[dir], 1.0, -1.0, hydro_flux_arr[dir]);
+              diffusion_flux_arr[dir], 1.0, -1.0, diffusion_flux_arr[dir]);
           }
 
-          // Filter
+          // Replace the hydro term of the fluxes by its filtered value
           const amrex::Box fbox = amrex::grow(cbox, -nGrowF);
           for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
             const amrex::Box& bxtmp = amrex::surroundingNodes(fbox, dir);
-            amrex::FArrayBox filtered_hydro_flux(
-              bxtmp, NVAR, amrex::The_Async_Arena());
-            les_filter.apply_filter(
-              bxtmp, hydro_flux[dir], filtered_hydro_flux, Density, NVAR);
-
-            setV(bxtmp, hydro_flux[dir].nComp(), hydro_flux_arr[dir], 0.0);
-            copy_array4(
-              bxtmp, hydro_flux[dir].nComp(), filtered_hydro_flux.array(),
-              hydro_flux_arr[dir]);
-          }
-
-          // Combine with diffusion
-          for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
-            lincomb_array4(
-              diffusion_flux[dir].box(), Density, NVAR, diffusion_flux_arr[dir],
-              hydro_flux_arr[dir], 1.0, 1.0, flx[dir]);
+            les_fused_filter.apply_increment(
+              les_filter, bxtmp, diffusion_flux[dir], flux_ec[dir], Density,
+              NVAR);
           }
         }
       }
@@ -530,8 +519,8 @@ PeleC::getMOLSrcTerm(
         amrex::Abort("multi-valued eb boundary fluxes to be implemented");
       }
 
-      // Extrapolate to GhostCells
-      if (MOLSrcTerm.nGrow() > 0) {
+      // Extrapolate to GhostCells (not needed when they were computed above)
+      if (MOLSrcTerm.nGrow() > ng_halo) {
         BL_PROFILE("PeleC::diffextrap()");
         const int mg = MOLSrcTerm.nGrow();
         const auto* low = vbox.loVect();
@@ -618,7 +607,17 @@ PeleC::getMOLSrcTerm(
 
         const int level_mask_not_covered = constants::level_mask_notcovered();
 
-        {
+        // The cached geometry does not cover the coarse-fine corrections
+        if (
+          eb_srd_cache && (redistribution_type == "StateRedist") &&
+          (as_crse == 0) && (as_fine == 0)) {
+          BL_PROFILE("pc_eb_state_redistribution()");
+          pc_eb_state_redistribution(
+            vbox, S.nComp(), Dterm, Dterm_tmp, S.const_array(mfi), scratch,
+            flag_arr, vfrac.const_array(mfi), AMREX_D_DECL(fcx, fcy, fcz), ccc,
+            d_bcs.dataPtr(), geom, dt, eb_srd_max_order,
+            stateRedistGeom(mfi, vbox));
+        } else {
           BL_PROFILE("ApplyMLRedistribution()");
           const amrex::Real fac_for_redist = (do_mol) ? 0.5 : 1.0;
           ApplyMLRedistribution(
@@ -660,8 +659,9 @@ PeleC::getMOLSrcTerm(
 
       if (do_mol_load_balance && (cost != nullptr)) {
         amrex::Gpu::streamSynchronize();
-        wt = (amrex::ParallelDescriptor::second() - wt) / vbox.d_numPts();
-        (*cost)[mfi].plus<amrex::RunOn::Device>(wt, vbox);
+        const amrex::Box tbox = mfi.tilebox();
+        wt = (amrex::ParallelDescriptor::second() - wt) / tbox.d_numPts();
+        (*cost)[mfi].plus<amrex::RunOn::Device>(wt, tbox);
       }
     }
   }
@@ -1,3 +1,4 @@
+#include "AMReX_EB_Redistribution.H"
 #include "EB.H"
 #include "Utilities.H"
 
@@ -806,6 +807,58 @@ pc_eb_clean_massfrac(
     });
 }
 
+// State redistribution of dUdt_in into dUdt_out, as done by
+// ApplyMLRedistribution, with the geometric data computed beforehand. There
+// are no coarse-fine corrections, so boxes next to another level must use
+// ApplyMLRedistribution.
+void
+pc_eb_state_redistribution(
+  const amrex::Box& bx,
+  const int ncomp,
+  amrex::Array4<amrex::Real> const& dUdt_out,
+  amrex::Array4<amrex::Real> const& dUdt_in,
+  amrex::Array4<const amrex::Real> const& U_in,
+  amrex::Array4<amrex::Real> const& scratch,
+  amrex::Array4<amrex::EBCellFlag const> const& flags,
+  amrex::Array4<const amrex::Real> const& vfrac,
+  AMREX_D_DECL(
+    amrex::Array4<const amrex::Real> const& fcx,
+    amrex::Array4<const amrex::Real> const& fcy,
+    amrex::Array4<const amrex::Real> const& fcz),
+  amrex::Array4<const amrex::Real> const& ccent,
+  amrex::BCRec const* bcs,
+  const amrex::Geometry& geom,
+  const amrex::Real dt,
+  const int max_order,
+  const EBStateRedistGeom& srd)
+{
+  AMREX_ASSERT(srd.bx == bx);
+  const auto& itr = srd.itracker.const_array();
+  const auto& nrs = srd.nrs.const_array();
+
+  amrex::ParallelFor(
+    amrex::Box(scratch), ncomp,
+    [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+      scratch(i, j, k, n) = U_in(i, j, k, n) + dt * dUdt_in(i, j, k, n);
+    });
+
+  amrex::StateRedistribute(
+    bx, ncomp, dUdt_out, scratch, flags, vfrac, AMREX_D_DECL(fcx, fcy, fcz),
+    ccent, bcs, itr, nrs, srd.alpha.const_array(), srd.nbhd_vol.const_array(),
+    srd.cent_hat.const_array(), geom, max_order);
+
+  // Only the cells that may have changed are updated, so that the result
+  // does not depend on the tiling
+  amrex::ParallelFor(
+    bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+      if (itr(i, j, k, 0) > 0 || nrs(i, j, k) > 1.0) {
+        dUdt_out(i, j, k, n) = (dUdt_out(i, j, k, n) - U_in(i, j, k, n)) / dt;
+      } else {
+        dUdt_out(i, j, k, n) = dUdt_in(i, j, k, n);
+      }
+    });
+}
+
 void
 pc_post_eb_redistribution(
   const amrex::Box& bx,
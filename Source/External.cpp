@@ -50,6 +50,8 @@ PeleC::fill_ext_source(
     dynamic_cast<amrex::EBFArrayBoxFactory const&>(state_old.Factory());
   auto const& flags = fact.getMultiEBCellFlagFab();
 
+  // ext_src starts at UMX unless the problem adds its own sources
+  const int scomp = source_footprint(sources::ext_src).scomp[0];
   auto const& Sns = state_new.const_arrays();
   auto const& Farrs = ext_src.arrays();
   auto const& flagarrs = flags.const_arrays();
@@ -61,13 +63,14 @@ PeleC::fill_ext_source(
   amrex::ParallelFor(
     ext_src, ngs, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
       if (!flagarrs[nbx](i, j, k).isCovered()) {
+        const auto farr = source_state_view(Farrs[nbx], scomp);
         amrex::Real e_force = 0.0;
         for (int idir = 0; idir < AMREX_SPACEDIM; idir++) {
-          Farrs[nbx](i, j, k, UMX + idir) = ext_force[idir];
+          farr(i, j, k, UMX + idir) = ext_force[idir];
           e_force += Sns[nbx](i, j, k, UMX + idir) / Sns[nbx](i, j, k, URHO) *
                      ext_force[idir];
         }
-        Farrs[nbx](i, j, k, UEDEN) = e_force;
+        farr(i, j, k, UEDEN) = e_force;
       }
     });
   amrex::Gpu::synchronize();
@@ -77,3 +80,12 @@ PeleC::fill_ext_source(
   ProblemSpecificFunctions::problem_modify_ext_sources(
     time, dt, state_old, state_new, ext_src, ng, geomdata, *lprobparm);
 }
+
+bool
+PeleC::problem_modifies_ext_source()
+{
+  // Problems that do not override the hook inherit the default, which does
+  // nothing
+  return &ProblemSpecificFunctions::problem_modify_ext_sources !=
+         &DefaultProblemSpecificFunctions::problem_modify_ext_sources;
+}
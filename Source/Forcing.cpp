@@ -1,10 +1,91 @@
+#include <array>
+
 #include <AMReX_REAL.H>
 #include <AMReX_GpuQualifiers.H>
 #include <AMReX_GpuMemory.H>
+#include <AMReX_Reduce.H>
 
 #include "PeleC.H"
 #include "IndexDefines.H"
 
+namespace {
+
+/** Lagged controller of the Lundgren forcing coefficient
+ *
+ *  The global sums needed for the Favre mean velocity and kinetic energy are
+ *  reduced with a non-blocking allreduce started when the old forcing source
+ *  of level 0 is built, and completed at the same point of the next step, so
+ *  that the reduction overlaps with the rest of the step. The coefficient is
+ *  therefore lagged by one step, except on the first step where the reduction
+ *  is blocking.
+ */
+struct LundgrenController
+{
+  // Sums of rho, rho * u, rho * v, rho * w and rho * |u|^2 over the domain
+  static constexpr int nsums = 5;
+  std::array<amrex::Real, nsums> sums = {0.0};
+  bool initialized = false;
+  bool pending = false;
+#ifdef AMREX_USE_MPI
+  MPI_Request request = MPI_REQUEST_NULL;
+#endif
+
+  amrex::Real coef = 0.0;
+  amrex::GpuArray<amrex::Real, 3> umean = {0.0};
+};
+
+LundgrenController lundgren;
+
+void
+start_reduction(bool blocking)
+{
+#ifdef AMREX_USE_MPI
+  MPI_Iallreduce(
+    MPI_IN_PLACE, lundgren.sums.data(), LundgrenController::nsums,
+    amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type(), MPI_SUM,
+    amrex::ParallelDescriptor::Communicator(), &lundgren.request);
+  if (blocking) {
+    MPI_Wait(&lundgren.request, MPI_STATUS_IGNORE);
+  }
+  lundgren.pending = !blocking;
+#else
+  amrex::ignore_unused(blocking);
+  lundgren.pending = false;
+#endif
+}
+
+void
+finish_reduction(amrex::Real eps0, amrex::Real k0)
+{
+#ifdef AMREX_USE_MPI
+  if (lundgren.pending) {
+    MPI_Wait(&lundgren.request, MPI_STATUS_IGNORE);
+    lundgren.pending = false;
+  }
+#endif
+  const auto& s = lundgren.sums;
+  if (s[0] <= 0.0) {
+    lundgren.coef = 0.0;
+    return;
+  }
+  amrex::Real umag2 = 0.0;
+  for (int dir = 0; dir < 3; dir++) {
+    lundgren.umean[dir] = s[1 + dir] / s[0];
+    umag2 += lundgren.umean[dir] * lundgren.umean[dir];
+  }
+  const amrex::Real k = 0.5 * (s[4] / s[0] - umag2);
+  if (k <= 0.0) {
+    lundgren.coef = 0.0;
+    return;
+  }
+  lundgren.coef = eps0 / (2.0 * k);
+  if (k0 > 0.0) {
+    lundgren.coef *= k0 / k;
+  }
+}
+
+} // namespace
+
 void
 PeleC::construct_old_forcing_source(amrex::Real /*time*/, amrex::Real /*dt*/)
 {
@@ -18,6 +99,10 @@ PeleC::construct_old_forcing_source(amrex::Real /*time*/, amrex::Real /*dt*/)
     return;
   }
 
+  if ((forcing_type == "lundgren") && (level == 0)) {
+    update_lundgren_forcing(S_old);
+  }
+
   fill_forcing_source(S_old, S_old, *old_sources[forcing_src], ng);
 
   old_sources[forcing_src]->FillBoundary(geom.periodicity());
@@ -40,6 +125,77 @@ PeleC::construct_new_forcing_source(amrex::Real /*time*/, amrex::Real /*dt*/)
   fill_forcing_source(S_old, S_new, *new_sources[forcing_src], ng);
 }
 
+void
+PeleC::finish_lundgren_forcing()
+{
+  // The result is not needed anymore, but the request must be completed
+  // before MPI is finalized
+#ifdef AMREX_USE_MPI
+  if (lundgren.pending) {
+    MPI_Wait(&lundgren.request, MPI_STATUS_IGNORE);
+  }
+#endif
+  lundgren = LundgrenController();
+}
+
+void
+PeleC::update_lundgren_forcing(const amrex::MultiFab& S)
+{
+  BL_PROFILE("PeleC::update_lundgren_forcing()");
+
+  // Use the sums reduced since the last call
+  if (lundgren.initialized) {
+    finish_reduction(forcing_eps0, forcing_k0);
+  }
+
+  amrex::ReduceOps<
+    amrex::ReduceOpSum, amrex::ReduceOpSum, amrex::ReduceOpSum,
+    amrex::ReduceOpSum, amrex::ReduceOpSum>
+    reduce_op;
+  amrex::ReduceData<
+    amrex::Real, amrex::Real, amrex::Real, amrex::Real, amrex::Real>
+    reduce_data(reduce_op);
+  using ReduceTuple = typename decltype(reduce_data)::Type;
+  for (amrex::MFIter mfi(S, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+    const amrex::Box& bx = mfi.tilebox();
+    auto const& sarr = S.const_array(mfi);
+    auto const& vf = vfrac.const_array(mfi);
+    reduce_op.eval(
+      bx, reduce_data,
+      [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept -> ReduceTuple {
+        const amrex::Real v = vf(i, j, k);
+        const amrex::Real rho = sarr(i, j, k, URHO);
+        if (v <= 0.0 || rho <= 0.0) {
+          return {0.0, 0.0, 0.0, 0.0, 0.0};
+        }
+        const amrex::Real mx = sarr(i, j, k, UMX);
+        const amrex::Real my = sarr(i, j, k, UMY);
+        const amrex::Real mz = sarr(i, j, k, UMZ);
+        return {
+          v * rho, v * mx, v * my, v * mz,
+          v * (mx * mx + my * my + mz * mz) / rho};
+      });
+  }
+  const ReduceTuple hv = reduce_data.value(reduce_op);
+  lundgren.sums = {
+    amrex::get<0>(hv), amrex::get<1>(hv), amrex::get<2>(hv),
+    amrex::get<3>(hv), amrex::get<4>(hv)};
+
+  if (!lundgren.initialized) {
+    // Nothing to lag on the first step
+    start_reduction(true);
+    finish_reduction(forcing_eps0, forcing_k0);
+    lundgren.initialized = true;
+  } else {
+    start_reduction(false);
+  }
+
+  if (verbose > 1) {
+    amrex::Print() << "... Lundgren forcing coefficient: " << lundgren.coef
+                   << std::endl;
+  }
+}
+
 void
 PeleC::fill_forcing_source(
   const amrex::MultiFab& state_old
@@ -56,7 +212,17 @@ PeleC::fill_forcing_source(
   amrex::Real v0 = forcing_v0;
   amrex::Real w0 = forcing_w0;
   amrex::Real force = forcing_force;
+  const bool favre = (forcing_type == "lundgren");
+  if (favre) {
+    u0 = lundgren.umean[0];
+    v0 = lundgren.umean[1];
+    w0 = lundgren.umean[2];
+    force = lundgren.coef;
+  }
 
+  // forcing_src only stores the momentum components
+  AMREX_ASSERT(forcing_src.nComp() == UMZ - UMX + 1);
+  const int scomp = source_footprint(sources::forcing_src).scomp[0];
   auto const& sarrs = state_new.const_arrays();
   auto const& srcs = forcing_src.arrays();
   auto const& flagarrs = flags.const_arrays();
@@ -66,7 +232,15 @@ PeleC::fill_forcing_source(
     [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
       if (!flagarrs[nbx](i, j, k).isCovered()) {
         const auto& sarr = sarrs[nbx];
-        const auto& src = srcs[nbx];
+        const auto src = source_state_view(srcs[nbx], scomp);
+        if (favre) {
+          // rho * (u - u_mean) for the Favre velocity fluctuations
+          const amrex::Real rho = sarr(i, j, k, URHO);
+          src(i, j, k, UMX) = force * (sarr(i, j, k, UMX) - rho * u0);
+          src(i, j, k, UMY) = force * (sarr(i, j, k, UMY) - rho * v0);
+          src(i, j, k, UMZ) = force * (sarr(i, j, k, UMZ) - rho * w0);
+          return;
+        }
         src(i, j, k, UMX) =
           force * sarr(i, j, k, URHO) * (sarr(i, j, k, UMX) - u0);
         src(i, j, k, UMY) =
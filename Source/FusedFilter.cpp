@@ -0,0 +1,64 @@
+#include <cmath>
+
+#include "FusedFilter.H"
+
+FusedFilter::FusedFilter(Filter& filter)
+{
+  const int ngrow = filter.get_filter_ngrow();
+  if ((AMREX_SPACEDIM != 3) || (ngrow < 1) || (ngrow > max_ngrow)) {
+    return;
+  }
+
+  // Response to a unit impulse at the origin, which is w(a) w(b) w(c) at
+  // (a, b, c) for a separable filter of 1D weights w
+  const amrex::Box center(amrex::IntVect(0), amrex::IntVect(0));
+  amrex::FArrayBox impulse(
+    amrex::grow(center, 2 * ngrow), 1, amrex::The_Async_Arena());
+  impulse.setVal<amrex::RunOn::Device>(0.0);
+  impulse.setVal<amrex::RunOn::Device>(1.0, center, 0, 1);
+  const amrex::Box rbox = amrex::grow(center, ngrow);
+  amrex::FArrayBox response(rbox, 1, amrex::The_Async_Arena());
+  filter.apply_filter(rbox, impulse, response, 0, 1);
+
+  amrex::FArrayBox h_response(rbox, 1, amrex::The_Pinned_Arena());
+  h_response.copy<amrex::RunOn::Device>(response, rbox, 0, rbox, 0, 1);
+  amrex::Gpu::streamSynchronize();
+  const auto& r = h_response.const_array();
+
+  const amrex::Real w0 = std::cbrt(r(0, 0, 0));
+  for (int a = -ngrow; a <= ngrow; ++a) {
+    m_weights[ngrow + a] = r(a, 0, 0) / (w0 * w0);
+  }
+  m_ngrow = ngrow;
+}
+
+void
+FusedFilter::apply_increment(
+  Filter& filter,
+  const amrex::Box& bx,
+  const amrex::FArrayBox& in,
+  amrex::FArrayBox& out,
+  const int scomp,
+  const int ncomp) const
+{
+  const auto& in_arr = in.const_array();
+  const auto& out_arr = out.array();
+  switch (m_ngrow) {
+  case 1:
+    fused_filter_increment<1>(bx, scomp, ncomp, m_weights, in_arr, out_arr);
+    break;
+  case 2:
+    fused_filter_increment<2>(bx, scomp, ncomp, m_weights, in_arr, out_arr);
+    break;
+  default: {
+    amrex::FArrayBox filtered(bx, in.nComp(), amrex::The_Async_Arena());
+    filter.apply_filter(bx, in, filtered, scomp, ncomp);
+    const auto& f_arr = filtered.const_array();
+    amrex::ParallelFor(
+      bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int nn) noexcept {
+        const int n = scomp + nn;
+        out_arr(i, j, k, n) += f_arr(i, j, k, n) - in_arr(i, j, k, n);
+      });
+  }
+  }
+}
@@ -186,18 +186,18 @@ pc_umeth_3D(
 
     int idir = 0;
     trace_ppm(
-      bxg2, idir, q, srcQ, qxmarr, qxparr, bxg2, dt, del, use_flattening,
-      use_hybrid_weno, weno_scheme);
+      bxg2, idir, q, qaux, srcQ, qxmarr, qxparr, bxg2, dt, del,
+      use_flattening, use_hybrid_weno, weno_scheme);
 
     idir = 1;
     trace_ppm(
-      bxg2, idir, q, srcQ, qymarr, qyparr, bxg2, dt, del, use_flattening,
-      use_hybrid_weno, weno_scheme);
+      bxg2, idir, q, qaux, srcQ, qymarr, qyparr, bxg2, dt, del,
+      use_flattening, use_hybrid_weno, weno_scheme);
 
     idir = 2;
     trace_ppm(
-      bxg2, idir, q, srcQ, qzmarr, qzparr, bxg2, dt, del, use_flattening,
-      use_hybrid_weno, weno_scheme);
+      bxg2, idir, q, qaux, srcQ, qzmarr, qzparr, bxg2, dt, del,
+      use_flattening, use_hybrid_weno, weno_scheme);
 
   } else {
     amrex::Error("PeleC::ppm_type must be 0 (PLM) or 1 (PPM)");
@@ -1107,13 +1107,13 @@ pc_umeth_2D(
 
     int idir = 0;
     trace_ppm(
-      bxg2, idir, q, srcQ, qxmarr, qxparr, bxg2, dt, del, use_flattening,
-      use_hybrid_weno, weno_scheme);
+      bxg2, idir, q, qaux, srcQ, qxmarr, qxparr, bxg2, dt, del,
+      use_flattening, use_hybrid_weno, weno_scheme);
 
     idir = 1;
     trace_ppm(
-      bxg2, idir, q, srcQ, qymarr, qyparr, bxg2, dt, del, use_flattening,
-      use_hybrid_weno, weno_scheme);
+      bxg2, idir, q, qaux, srcQ, qymarr, qyparr, bxg2, dt, del,
+      use_flattening, use_hybrid_weno, weno_scheme);
 
   } else {
     amrex::Error("PeleC::ppm_type must be 0 (PLM) or 1 (PPM)");
@@ -18,6 +18,7 @@ PeleC::construct_hydro_source(
     hydro_source.setVal(0);
   } else {
     BL_PROFILE("PeleC::construct_hydro_source()");
+    pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::hydro);
 
     if ((verbose != 0) && amrex::ParallelDescriptor::IOProcessor()) {
       amrex::Print() << "... Computing Godunov hydro advance" << std::endl;
@@ -28,10 +29,8 @@ PeleC::construct_hydro_source(
     const int ng = 0;
     sources_for_hydro.setVal(0.0);
     for (int src : src_list) {
-      amrex::MultiFab::Saxpy(
-        sources_for_hydro, 0.5, *new_sources[src], 0, 0, NVAR, ng);
-      amrex::MultiFab::Saxpy(
-        sources_for_hydro, 0.5, *old_sources[src], 0, 0, NVAR, ng);
+      saxpy_source(sources_for_hydro, 0.5, *new_sources[src], src, ng);
+      saxpy_source(sources_for_hydro, 0.5, *old_sources[src], src, ng);
     }
 
     // Add I_R terms to advective forcing
@@ -230,6 +229,13 @@ PeleC::construct_hydro_source(
 
           const auto& dxInv = geom.InvCellSizeArray();
 
+          // The cached geometry does not cover the coarse-fine corrections
+          const EBStateRedistGeom* srd =
+            (eb_srd_cache && (redistribution_type == "StateRedist") &&
+             (as_crse == 0) && (as_fine == 0))
+              ? &stateRedistGeom(mfi, fbx)
+              : nullptr;
+
           pc_umdrv_eb(
             fbx, fbxg_i, mfi, geom, &fact, phys_bc.lo(), phys_bc.hi(), sarr,
             hyd_src, qarr, qauxar, srcqarr, vfrac_arr, flag_arr, dx, dxInv,
@@ -237,7 +243,7 @@ PeleC::construct_hydro_source(
             p_rrflag_as_crse->array(), as_fine, dm_as_fine.array(),
             level_mask.const_array(mfi), dt, ppm_type, plm_iorder,
             use_flattening, difmag, bcs_d.data(), redistribution_type,
-            eb_weights_type, eb_srd_max_order, eb_clean_massfrac,
+            eb_weights_type, eb_srd_max_order, srd, eb_clean_massfrac,
             eb_clean_massfrac_threshold, cflLoc);
 
         } else if (flag_fab.getType(fbxg_i) == amrex::FabType::regular) {
@@ -256,26 +262,24 @@ PeleC::construct_hydro_source(
         // Filter hydro source and fluxes here
         if (use_explicit_filter) {
           BL_PROFILE("PeleC::apply_filter()");
+          // The filter is applied in place from a copy of the stencil region
+          amrex::FArrayBox filter_in;
           for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
             const amrex::Box& bxtmp = amrex::surroundingNodes(bx, dir);
-            amrex::FArrayBox filtered_flux(
-              bxtmp, NVAR, amrex::The_Async_Arena());
-            les_filter.apply_filter(
-              bxtmp, flux[dir], filtered_flux, Density, NVAR);
-
-            setV(bxtmp, flux[dir].nComp(), flx_arr[dir], 0.0);
-            copy_array4(
-              bxtmp, flux[dir].nComp(), filtered_flux.array(), flx_arr[dir]);
+            const amrex::Box& gbx = amrex::grow(bxtmp, nGrowF);
+            filter_in.resize(gbx, NVAR, amrex::The_Async_Arena());
+            filter_in.copy<amrex::RunOn::Device>(
+              flux[dir], gbx, Density, gbx, Density, NVAR);
+            les_fused_filter.apply_increment(
+              les_filter, bxtmp, filter_in, flux[dir], Density, NVAR);
           }
 
-          amrex::FArrayBox filtered_source_out(
-            bx, NVAR, amrex::The_Async_Arena());
-          les_filter.apply_filter(
-            bx, hydro_source[mfi], filtered_source_out, Density, NVAR);
-
-          setV(bx, hyd_src.nComp(), hyd_src, 0.0);
-          copy_array4(
-            bx, hyd_src.nComp(), filtered_source_out.array(), hyd_src);
+          const amrex::Box& gbx = amrex::grow(bx, nGrowF);
+          filter_in.resize(gbx, NVAR, amrex::The_Async_Arena());
+          filter_in.copy<amrex::RunOn::Device>(
+            hydro_source[mfi], gbx, Density, gbx, Density, NVAR);
+          les_fused_filter.apply_increment(
+            les_filter, bx, filter_in, hydro_source[mfi], Density, NVAR);
         }
 
         // Refluxing
@@ -291,6 +295,7 @@ PeleC::construct_hydro_source(
       }
     }
 
+    pele::Telemetry::recordCourant(level, courno);
     if (courno > 1.0) {
       amrex::Print() << "WARNING -- EFFECTIVE CFL AT THIS LEVEL " << level
                      << " IS " << courno << '\n';
@@ -664,6 +669,7 @@ pc_umdrv_eb(
   const std::string& redistribution_type,
   const int eb_weights_type,
   const int eb_srd_max_order,
+  const EBStateRedistGeom* srd_geom,
   const bool eb_clean_massfrac,
   const amrex::Real eb_clean_massfrac_threshold,
   amrex::Real /*cflLoc*/)
@@ -775,7 +781,13 @@ pc_umdrv_eb(
   const bool use_wts_in_divnc = false;
 
   const amrex::Real fac_for_redist = 1.0;
-  {
+  if (srd_geom != nullptr) {
+    BL_PROFILE("pc_eb_state_redistribution()");
+    pc_eb_state_redistribution(
+      bx, l_ncomp, uout, divc_arr, uin, redistwgt_arr, flag, vf,
+      AMREX_D_DECL(fcx, fcy, fcz), ccc, bcs_d_ptr, geom, dt, eb_srd_max_order,
+      *srd_geom);
+  } else {
     BL_PROFILE("ApplyMLRedistribution()");
     ApplyMLRedistribution(
       bx, l_ncomp, uout, divc_arr, uin, redistwgt_arr, flag,
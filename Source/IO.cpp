@@ -122,14 +122,16 @@ PeleC::restart(amrex::Amr& papa, std::istream& is, bool bReadSpecial)
   for (int src : src_list) {
     int oldGrow = numGrow();
     int newGrow = S_new.nGrow();
+    const int ncomp = source_footprint(src).size();
     old_sources[src] = std::make_unique<amrex::MultiFab>(
-      grids, dmap, NVAR, oldGrow, amrex::MFInfo(), Factory());
+      grids, dmap, ncomp, oldGrow, amrex::MFInfo(), Factory());
     new_sources[src] = std::make_unique<amrex::MultiFab>(
-      grids, dmap, NVAR, newGrow, amrex::MFInfo(), Factory());
+      grids, dmap, ncomp, newGrow, amrex::MFInfo(), Factory());
   }
 
+  const int nGrowS = numGrow() + nGrowDeepHalo();
   if (do_hydro || do_diffuse) {
-    Sborder.define(grids, dmap, NVAR, numGrow(), amrex::MFInfo(), Factory());
+    Sborder.define(grids, dmap, NVAR, nGrowS, amrex::MFInfo(), Factory());
   }
 
   if (!do_mol) {
@@ -145,7 +147,7 @@ PeleC::restart(amrex::Amr& papa, std::istream& is, bool bReadSpecial)
         grids, dmap, NVAR, numGrow(), amrex::MFInfo(), Factory());
     }
   } else {
-    Sborder.define(grids, dmap, NVAR, numGrow(), amrex::MFInfo(), Factory());
+    Sborder.define(grids, dmap, NVAR, nGrowS, amrex::MFInfo(), Factory());
   }
 
   // get the elapsed CPU time to now
@@ -227,6 +229,9 @@ PeleC::set_state_in_checkpoint(amrex::Vector<int>& state_in_checkpoint)
     } else if (i == Work_Estimate_Type) {
       // Never use work estimate checkpoint
       state_in_checkpoint[i] = 0;
+    } else if (i == Stats_Type) {
+      // Statistics start from zero if absent
+      state_in_checkpoint[i] = (doStats() && is_present) ? 1 : 0;
     } else {
       amrex::Abort("Unknown StateType");
     }
@@ -240,6 +245,7 @@ PeleC::checkPoint(
   amrex::VisMF::How how,
   bool /*dump_old_default*/)
 {
+  pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::io);
   amrex::AmrLevel::checkPoint(dir, os, how, dump_old);
 
 #ifdef PELE_USE_SPRAY
@@ -328,6 +334,12 @@ PeleC::setPlotVariables()
     }
   }
 
+  if (!doStats()) {
+    for (int i = 0; i < desc_lst[Stats_Type].nComp(); i++) {
+      amrex::Amr::deleteStatePlotVar(desc_lst[Stats_Type].name(i));
+    }
+  }
+
   bool plot_rhoy = true;
   pp.query("plot_rhoy", plot_rhoy);
   if (plot_rhoy) {
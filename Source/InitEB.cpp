@@ -55,6 +55,8 @@ PeleC::initialize_eb2_structs()
   sv_eb_bndry_grad_stencil.resize(vfrac.local_size());
   sv_eb_flux.resize(vfrac.local_size());
   sv_eb_bcval.resize(vfrac.local_size());
+  srd_geom.clear();
+  srd_geom.resize(vfrac.local_size());
 
   auto const& flags = ebfactory.getMultiEBCellFlagFab();
 
@@ -580,6 +582,67 @@ PeleC::extend_signed_distance(
   }
 }
 
+const EBStateRedistGeom&
+PeleC::stateRedistGeom(const amrex::MFIter& mfi, const amrex::Box& bx)
+{
+  const int iLocal = mfi.LocalIndex();
+  EBStateRedistGeom* srd = nullptr;
+
+  // Tiles of the same fab may be processed by different threads
+#ifdef AMREX_USE_OMP
+#pragma omp critical(pelec_srd_geom)
+#endif
+  {
+    for (const auto& g : srd_geom[iLocal]) {
+      if (g->bx == bx) {
+        srd = g.get();
+        break;
+      }
+    }
+
+    if (srd == nullptr) {
+      BL_PROFILE("PeleC::stateRedistGeom()");
+      auto g = std::make_unique<EBStateRedistGeom>();
+      g->bx = bx;
+      const amrex::Box bxg3 = amrex::grow(bx, 3);
+      const amrex::Box bxg4 = amrex::grow(bx, 4);
+      g->itracker.resize(bxg4, (AMREX_SPACEDIM < 3) ? 4 : 8);
+      g->nrs.resize(bxg3, 1);
+      g->alpha.resize(bxg3, 2);
+      g->nbhd_vol.resize(bxg3, 1);
+      g->cent_hat.resize(bxg3, AMREX_SPACEDIM);
+      g->itracker.setVal<amrex::RunOn::Device>(0);
+      g->nrs.setVal<amrex::RunOn::Device>(0.0);
+      g->alpha.setVal<amrex::RunOn::Device>(0.0);
+      g->nbhd_vol.setVal<amrex::RunOn::Device>(0.0);
+      g->cent_hat.setVal<amrex::RunOn::Device>(0.0);
+
+      auto const& fact =
+        dynamic_cast<amrex::EBFArrayBoxFactory const&>(Factory());
+      auto const& flag_arr = fact.getMultiEBCellFlagFab()[mfi].const_array();
+      auto const& vfrac_arr = vfrac.const_array(mfi);
+      auto const& ccc = fact.getCentroid().const_array(mfi);
+      AMREX_D_TERM(auto const& apx = areafrac[0]->const_array(mfi);
+                   , auto const& apy = areafrac[1]->const_array(mfi);
+                   , auto const& apz = areafrac[2]->const_array(mfi););
+
+      // Same target volume fraction as ApplyMLRedistribution
+      const amrex::Real target_volfrac = 0.5;
+      amrex::MakeITracker(
+        bx, AMREX_D_DECL(apx, apy, apz), vfrac_arr, g->itracker.array(), geom,
+        target_volfrac);
+      amrex::MakeStateRedistUtils(
+        bx, flag_arr, vfrac_arr, ccc, g->itracker.const_array(),
+        g->nrs.array(), g->alpha.array(), g->nbhd_vol.array(),
+        g->cent_hat.array(), geom, target_volfrac);
+
+      srd = g.get();
+      srd_geom[iLocal].push_back(std::move(g));
+    }
+  }
+  return *srd;
+}
+
 void
 PeleC::InitialRedistribution(
   const amrex::Real time,
@@ -341,7 +341,7 @@ PeleC::getDynamicSmagorinskyLESTerm(
 {
   amrex::Abort("LES only implemented in 3D for now");
 #else
-  amrex::Real time,
+  amrex::Real /*time*/,
   amrex::Real dt,
   amrex::MultiFab& LESTerm,
   amrex::Real reflux_factor)
@@ -352,10 +352,10 @@ PeleC::getDynamicSmagorinskyLESTerm(
     N + 0                             (cbox) |----->         LESTerm
     N + 0**                           (ebox) |----->         flux_ec, coeff_ec, alphaij_ec, alpha_ec, flux_T_ec
     N + 1                            (g4box) |------>        filtered_coeff_cc [= LES_Coeffs]
-    N + 1 + nGrowC                   (g3box) |-------->      coeff_cc, filtered_(K, RUT, alphaij, alpha, flux_T)
+    N + 1 + nGrowC                   (g3box) |-------->      coeff_cc, filtered_sfs
     N + 1 + nGrowC + nGrowD          (g2box) |---------->    filtered_(S, Q, Qaux)
-    N + 1 + nGrowC + nGrowT          (g1box) |----------->   K, RUT, alphaij, alpha, flux_T
-    N + 1 + nGrowC + nGrowT + nGrowD (g0box) |-------------> S, Q, Qaux
+    N + 1 + nGrowC + nGrowT          (g1box) |----------->   sfs = (K, RUT, alphaij, alpha, flux_T)
+    N + 1 + nGrowC + nGrowT + nGrowD (g0box) |-------------> S [= Sborder], Q, Qaux
        |----------------------------|
        This is the number of grow cells on each side
 
@@ -368,38 +368,56 @@ PeleC::getDynamicSmagorinskyLESTerm(
        are moved to edge/faces centers (ec) to calculate the fluxes. ec quantities have length N+1 in the face-normal
        direction and length N in the other two directions.
 
+    The state is read from Sborder, which the caller filled on g0box (nGrowDLES grow cells) at the time of this term.
+
+    The coefficients are only computed every les_coeff_int steps of the level. On the other steps, the lagged LES_Coeffs
+    are reused and the derived quantities are only needed on g4box, so Q and Qaux are only computed on g4box + nGrowD.
   */
   // clang-format on
-  Filter test_filter = Filter(les_test_filter_type, les_test_filter_fgr);
-  Filter coeff_filter = Filter(box, 6);
-
   const int nGrowD = 1;
-  const int nGrowC = coeff_filter.get_filter_ngrow();
-  const int nGrowT = test_filter.get_filter_ngrow();
+  const int nGrowC = les_coeff_filter.get_filter_ngrow();
+  const int nGrowT = les_test_filter.get_filter_ngrow();
+  AMREX_ASSERT(nGrowDLES == nGrowD + nGrowC + nGrowT + 1);
+  AMREX_ASSERT(Sborder.nGrow() >= nGrowDLES);
 
   const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx = geom.CellSizeArray();
 
-  // 1. Get state variable data
-  amrex::MultiFab S(
-    grids, dmap, NVAR, nGrowD + nGrowC + nGrowT + 1, amrex::MFInfo(),
-    Factory());
-  FillPatch(*this, S, nGrowD + nGrowC + nGrowT + 1, time, State_Type, 0, NVAR);
-  LES_Coeffs.setVal(0.0);
+  const bool update_coeffs = (les_coeff_int <= 1) || (les_coeffs_step < 0) ||
+                             (nStep() - les_coeffs_step >= les_coeff_int);
+  if (update_coeffs) {
+    LES_Coeffs.setVal(0.0);
+    les_coeffs_step = nStep();
+  } else if (verbose != 0) {
+    amrex::Print() << "... Reusing dynamic Smagorinsky coefficients of step "
+                   << les_coeffs_step << std::endl;
+  }
+
+  // The derived quantities are stored in a single fab so that they are test
+  // filtered in one pass
+  const int upper_triangle_n =
+    static_cast<int>(0.5 * AMREX_SPACEDIM * (AMREX_SPACEDIM + 1));
+  const int comp_K = 0;
+  const int comp_RUT = comp_K + upper_triangle_n;
+  const int comp_alphaij = comp_RUT + AMREX_SPACEDIM;
+  const int comp_alpha = comp_alphaij + AMREX_SPACEDIM * AMREX_SPACEDIM;
+  const int comp_flux_T = comp_alpha + 1;
+  const int nsfs = comp_flux_T + AMREX_SPACEDIM;
 
   auto const& fact =
-    dynamic_cast<amrex::EBFArrayBoxFactory const&>(S.Factory());
+    dynamic_cast<amrex::EBFArrayBoxFactory const&>(Sborder.Factory());
   auto const& flags = fact.getMultiEBCellFlagFab();
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
   {
-    for (amrex::MFIter mfi(S, amrex::TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+    for (amrex::MFIter mfi(LESTerm, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
       const amrex::Box vbox = mfi.tilebox();
-      const amrex::Box g0box = amrex::grow(vbox, nGrowD + nGrowC + nGrowT + 1);
-      const amrex::Box g1box = amrex::grow(vbox, nGrowC + nGrowT + 1);
-      const amrex::Box g2box = amrex::grow(vbox, nGrowD + nGrowC + 1);
-      const amrex::Box g3box = amrex::grow(vbox, nGrowC + 1);
+      const amrex::Box g1box =
+        update_coeffs ? amrex::grow(vbox, nGrowC + nGrowT + 1)
+                      : amrex::grow(vbox, 1);
+      const amrex::Box g0box = amrex::grow(g1box, nGrowD);
       const amrex::Box g4box = amrex::grow(vbox, 1);
       const amrex::Box cbox = amrex::grow(vbox, 0);
 
@@ -412,7 +430,7 @@ PeleC::getDynamicSmagorinskyLESTerm(
         continue;
       }
 
-      auto const& s = S.array(mfi);
+      auto const& s = Sborder.array(mfi);
       int nqaux = NQAUX > 0 ? NQAUX : 1;
       amrex::FArrayBox q(g0box, QVAR, amrex::The_Async_Arena());
       amrex::FArrayBox qaux(g0box, nqaux, amrex::The_Async_Arena());
@@ -432,20 +450,15 @@ PeleC::getDynamicSmagorinskyLESTerm(
       // 2. Get dynamic Smagorinsky derived quantities after setting the
       // BC. These quantities need to be stored because we need to filter
       // them at the test filter level. All are located at cell centers.
-      const int upper_triangle_n =
-        static_cast<int>(0.5 * AMREX_SPACEDIM * (AMREX_SPACEDIM + 1));
-      amrex::FArrayBox K(g1box, upper_triangle_n, amrex::The_Async_Arena());
-      amrex::FArrayBox RUT(g1box, AMREX_SPACEDIM, amrex::The_Async_Arena());
-      amrex::FArrayBox alphaij(
-        g1box, AMREX_SPACEDIM * AMREX_SPACEDIM, amrex::The_Async_Arena());
-      amrex::FArrayBox alpha(g1box, 1, amrex::The_Async_Arena());
-      amrex::FArrayBox flux_T(g1box, AMREX_SPACEDIM, amrex::The_Async_Arena());
-
-      auto const& K_ar = K.array();
-      auto const& RUT_ar = RUT.array();
-      auto const& alphaij_ar = alphaij.array();
-      auto const& alpha_ar = alpha.array();
-      auto const& flux_T_ar = flux_T.array();
+      amrex::FArrayBox sfs(g1box, nsfs, amrex::The_Async_Arena());
+      auto const& sfs_ar = sfs.array();
+      const amrex::Array4<amrex::Real> K_ar(sfs_ar, comp_K, upper_triangle_n);
+      const amrex::Array4<amrex::Real> RUT_ar(sfs_ar, comp_RUT, AMREX_SPACEDIM);
+      const amrex::Array4<amrex::Real> alphaij_ar(
+        sfs_ar, comp_alphaij, AMREX_SPACEDIM * AMREX_SPACEDIM);
+      const amrex::Array4<amrex::Real> alpha_ar(sfs_ar, comp_alpha, 1);
+      const amrex::Array4<amrex::Real> flux_T_ar(
+        sfs_ar, comp_flux_T, AMREX_SPACEDIM);
       {
         const int les_filter_fgr_local = PeleC::les_filter_fgr;
         BL_PROFILE("PeleC::pc_smagorinsky_sfs_term()");
@@ -457,66 +470,64 @@ PeleC::getDynamicSmagorinskyLESTerm(
           });
       }
 
-      // 3. Filter the state variables and the derived quantities at the
-      // test filter level - still at cell centers
-      amrex::FArrayBox filtered_S(g2box, NVAR, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_Q(g2box, QVAR, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_Qaux(
-        g2box, NQAUX > 0 ? NQAUX : 1, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_K(
-        g3box, upper_triangle_n, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_RUT(
-        g3box, AMREX_SPACEDIM, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_alphaij(
-        g3box, AMREX_SPACEDIM * AMREX_SPACEDIM, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_alpha(g3box, 1, amrex::The_Async_Arena());
-      amrex::FArrayBox filtered_flux_T(
-        g3box, AMREX_SPACEDIM, amrex::The_Async_Arena());
-
-      auto const& filtered_S_ar = filtered_S.array();
-      auto const& filtered_Q_ar = filtered_Q.array();
-      auto const& filtered_Qaux_ar = filtered_Qaux.array();
-
-      const amrex::FArrayBox& Sfab = S[mfi];
-      test_filter.apply_filter(g2box, Sfab, filtered_S);
-      {
-        BL_PROFILE("PeleC::ctoprim()");
-        amrex::ParallelFor(
-          g2box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            pc_ctoprim(i, j, k, filtered_S_ar, filtered_Q_ar, filtered_Qaux_ar);
-          });
-      }
-      test_filter.apply_filter(g3box, K, filtered_K);
-      test_filter.apply_filter(g3box, RUT, filtered_RUT);
-      test_filter.apply_filter(g3box, alphaij, filtered_alphaij);
-      test_filter.apply_filter(g3box, alpha, filtered_alpha);
-      test_filter.apply_filter(g3box, flux_T, filtered_flux_T);
-
-      // 4. Calculate the dynamic Smagorinsky coefficients - still at cell
-      // centers
-      amrex::FArrayBox coeff_cc(g3box, nCompC, amrex::The_Async_Arena());
-      auto const& coeff_cc_ar = coeff_cc.array();
-      auto const& filtered_K_ar = filtered_K.array();
-      auto const& filtered_RUT_ar = filtered_RUT.array();
-      auto const& filtered_alphaij_ar = filtered_alphaij.array();
-      auto const& filtered_alpha_ar = filtered_alpha.array();
-      auto const& filtered_flux_T_ar = filtered_flux_T.array();
-      {
-        const int les_test_filter_fgr_local = PeleC::les_test_filter_fgr;
-        BL_PROFILE("PeleC::pc_dynamic_smagorinsky_coeffs()");
-        amrex::ParallelFor(
-          g3box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-            pc_dynamic_smagorinsky_coeffs(
-              i, j, k, filtered_Q_ar, les_test_filter_fgr_local, dx,
-              filtered_K_ar, filtered_RUT_ar, filtered_alphaij_ar,
-              filtered_alpha_ar, filtered_flux_T_ar, coeff_cc_ar);
-          });
-      }
+      if (update_coeffs) {
+        const amrex::Box g2box = amrex::grow(vbox, nGrowD + nGrowC + 1);
+        const amrex::Box g3box = amrex::grow(vbox, nGrowC + 1);
+
+        // 3. Filter the state variables and the derived quantities at the
+        // test filter level - still at cell centers
+        amrex::FArrayBox filtered_S(g2box, NVAR, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_Q(g2box, QVAR, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_Qaux(g2box, nqaux, amrex::The_Async_Arena());
+        amrex::FArrayBox filtered_sfs(g3box, nsfs, amrex::The_Async_Arena());
+
+        auto const& filtered_S_ar = filtered_S.array();
+        auto const& filtered_Q_ar = filtered_Q.array();
+        auto const& filtered_Qaux_ar = filtered_Qaux.array();
+
+        les_test_filter.apply_filter(g2box, Sborder[mfi], filtered_S);
+        {
+          BL_PROFILE("PeleC::ctoprim()");
+          amrex::ParallelFor(
+            g2box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              pc_ctoprim(
+                i, j, k, filtered_S_ar, filtered_Q_ar, filtered_Qaux_ar);
+            });
+        }
+        les_test_filter.apply_filter(g3box, sfs, filtered_sfs, 0, nsfs);
+
+        // 4. Calculate the dynamic Smagorinsky coefficients - still at cell
+        // centers
+        amrex::FArrayBox coeff_cc(g3box, nCompC, amrex::The_Async_Arena());
+        auto const& coeff_cc_ar = coeff_cc.array();
+        auto const& filtered_sfs_ar = filtered_sfs.const_array();
+        const amrex::Array4<const amrex::Real> filtered_K_ar(
+          filtered_sfs_ar, comp_K, upper_triangle_n);
+        const amrex::Array4<const amrex::Real> filtered_RUT_ar(
+          filtered_sfs_ar, comp_RUT, AMREX_SPACEDIM);
+        const amrex::Array4<const amrex::Real> filtered_alphaij_ar(
+          filtered_sfs_ar, comp_alphaij, AMREX_SPACEDIM * AMREX_SPACEDIM);
+        const amrex::Array4<const amrex::Real> filtered_alpha_ar(
+          filtered_sfs_ar, comp_alpha, 1);
+        const amrex::Array4<const amrex::Real> filtered_flux_T_ar(
+          filtered_sfs_ar, comp_flux_T, AMREX_SPACEDIM);
+        {
+          const int les_test_filter_fgr_local = PeleC::les_test_filter_fgr;
+          BL_PROFILE("PeleC::pc_dynamic_smagorinsky_coeffs()");
+          amrex::ParallelFor(
+            g3box, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              pc_dynamic_smagorinsky_coeffs(
+                i, j, k, filtered_Q_ar, les_test_filter_fgr_local, dx,
+                filtered_K_ar, filtered_RUT_ar, filtered_alphaij_ar,
+                filtered_alpha_ar, filtered_flux_T_ar, coeff_cc_ar);
+            });
+        }
 
-      // 5. Filter to smooth the dynamic coefficients - still at cell
-      // centers
+        // 5. Filter to smooth the dynamic coefficients - still at cell
+        // centers
+        les_coeff_filter.apply_filter(g4box, coeff_cc, LES_Coeffs[mfi]);
+      }
       auto const& LES_Coeffs_ar = LES_Coeffs[mfi].array();
-      coeff_filter.apply_filter(g4box, coeff_cc, LES_Coeffs[mfi]);
 
       // 6. Get the SFS term
 
@@ -7,6 +7,7 @@ trace_ppm(
   const amrex::Box& bx,
   const int idir,
   amrex::Array4<amrex::Real const> const& q_arr,
+  amrex::Array4<amrex::Real const> const& qaux,
   amrex::Array4<amrex::Real const> const& /*srcQ*/,
   amrex::Array4<amrex::Real> const& qm,
   amrex::Array4<amrex::Real> const& qp,
@@ -92,13 +93,8 @@ trace_ppm(
 
     auto eos = pele::physics::PhysicsType::eos();
 
-    amrex::Real massfrac[NUM_SPECIES];
-    for (int species = 0; species < NUM_SPECIES; ++species) {
-      massfrac[species] = q_arr(iv, species + QFS);
-    }
-
-    amrex::Real cc = 0;
-    eos.RPY2Cs(q_arr(iv, QRHO), q_arr(iv, QPRES), massfrac, cc);
+    // Sound speed of the cell, computed with the primitive variables
+    const amrex::Real cc = qaux(iv, QC);
 
     amrex::Real un = q_arr(iv, QUN);
 
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "PeleC.H"
 #include "SprayParticles.H"
 
@@ -11,6 +13,53 @@ int sprayEngSrcIndx = 1 + AMREX_SPACEDIM;
 int spraySpecSrcIndx = 2 + AMREX_SPACEDIM;
 
 int particle_verbose = 0;
+
+// Sort the spray particles by cell when the fraction of particles out of
+// order in their tile exceeds this value; negative to never sort
+amrex::Real spray_sort_disorder = -1.0;
+
+// Maximum number of particle substeps within a gas step; the particles only
+// limit the gas time step to this many times their own time step. Only
+// single level runs are sub-cycled, since the virtual and ghost particles of
+// the other levels are not redistributed between substeps.
+int spray_max_substeps = 1;
+
+// Fraction of the particles of a level whose cell comes before the cell of
+// the previous particle of their tile
+amrex::Real
+sprayDisorder(SprayParticleContainer& pc, const int lev)
+{
+  BL_PROFILE("PeleC::sprayDisorder()");
+  const auto plo = pc.Geom(lev).ProbLoArray();
+  const auto dxi = pc.Geom(lev).InvCellSizeArray();
+  const amrex::Box domain = pc.Geom(lev).Domain();
+
+  amrex::ReduceOps<amrex::ReduceOpSum> reduce_op;
+  amrex::ReduceData<amrex::Long> reduce_data(reduce_op);
+  amrex::Long counts[2] = {0, 0};
+  for (SprayParticleContainer::ParIterType pti(pc, lev); pti.isValid(); ++pti) {
+    const int np = pti.numParticles();
+    counts[1] += np;
+    if (np < 2) {
+      continue;
+    }
+    const auto* pstruct = pti.GetArrayOfStructs()().dataPtr();
+    reduce_op.eval(
+      np - 1, reduce_data,
+      [=] AMREX_GPU_DEVICE(int i) -> amrex::GpuTuple<amrex::Long> {
+        const auto c0 =
+          domain.index(amrex::getParticleCell(pstruct[i], plo, dxi, domain));
+        const auto c1 = domain.index(
+          amrex::getParticleCell(pstruct[i + 1], plo, dxi, domain));
+        return {static_cast<amrex::Long>(c1 < c0)};
+      });
+  }
+  counts[0] = amrex::get<0>(reduce_data.value(reduce_op));
+  amrex::ParallelDescriptor::ReduceLongSum(counts, 2);
+  return (counts[1] > 0) ? static_cast<amrex::Real>(counts[0]) /
+                             static_cast<amrex::Real>(counts[1])
+                         : 0.0;
+}
 } // namespace
 
 std::unique_ptr<SprayParticleContainer> PeleC::SprayPC = nullptr;
@@ -20,6 +69,26 @@ std::unique_ptr<SprayParticleContainer> PeleC::GhostPC = nullptr;
 // momentum + density + fuel species + energy
 int PeleC::num_spray_src = AMREX_SPACEDIM + 2 + SPRAY_FUEL_NUM;
 
+amrex::Real
+PeleC::sprayMass()
+{
+  BL_PROFILE("PeleC::sprayMass()");
+  const auto& names = SprayParticleContainer::DeriveVarNames();
+  const auto it = std::find(names.begin(), names.end(), "spray_mass");
+  if (it == names.end()) {
+    amrex::Abort("sprayMass requires the spray_mass derived variable");
+  }
+  const int comp = static_cast<int>(std::distance(names.begin(), it));
+  amrex::MultiFab spray_derive(
+    grids, dmap, SprayParticleContainer::NumDeriveVars(), 0, amrex::MFInfo(),
+    Factory());
+  spray_derive.setVal(0.);
+  SprayPC->computeDerivedVars(spray_derive, level, 0);
+  // The derived spray mass is per unit cell volume
+  const auto dx = geom.CellSizeArray();
+  return spray_derive.sum(comp, true) * AMREX_D_TERM(dx[0], *dx[1], *dx[2]);
+}
+
 void
 PeleC::estTimeStepParticles(amrex::Real& est_dt)
 {
@@ -30,7 +99,8 @@ PeleC::estTimeStepParticles(amrex::Real& est_dt)
   amrex::Real est_dt_particle = SprayPC->estTimestep(level);
 
   if (est_dt_particle > 0) {
-    est_dt = amrex::min<amrex::Real>(est_dt, est_dt_particle);
+    est_dt =
+      amrex::min<amrex::Real>(est_dt, spray_max_substeps * est_dt_particle);
   }
 
   if (particle_verbose >= 2 && amrex::ParallelDescriptor::IOProcessor()) {
@@ -43,12 +113,45 @@ PeleC::estTimeStepParticles(amrex::Real& est_dt)
   }
 }
 
+void
+PeleC::addParticleWorkEstimate(const amrex::Real elapsed)
+{
+  if (!(do_mol_load_balance || do_react_load_balance)) {
+    return;
+  }
+  BL_PROFILE("PeleC::addParticleWorkEstimate()");
+
+  // The measured cost per particle of this rank, times the particles of
+  // each cell, is added to the measured cost of the cells
+  amrex::MultiFab counts(grids, dmap, 1, 0);
+  counts.setVal(0.0);
+  SprayPC->Increment(counts, level);
+  const amrex::Real nlocal = counts.sum(0, true);
+  if (nlocal > 0.0) {
+    amrex::MultiFab::Saxpy(
+      get_new_data(Work_Estimate_Type), elapsed / nlocal, counts, 0, 0, 1, 0);
+  }
+}
+
 void
 PeleC::readSprayParams()
 {
   amrex::ParmParse pp("pelec");
 
   pp.query("do_spray_particles", do_spray_particles);
+  pp.query("spray_sort_disorder", spray_sort_disorder);
+  pp.query("spray_max_substeps", spray_max_substeps);
+  if (spray_max_substeps < 1) {
+    amrex::Abort("pelec.spray_max_substeps must be at least 1");
+  }
+  if (spray_max_substeps > 1) {
+    int max_level = 0;
+    amrex::ParmParse ppa("amr");
+    ppa.query("max_level", max_level);
+    if (max_level > 0) {
+      amrex::Abort("pelec.spray_max_substeps > 1 requires amr.max_level = 0");
+    }
+  }
   if (do_spray_particles) {
     SprayParticleContainer::readSprayParams(particle_verbose);
   }
@@ -90,16 +193,88 @@ PeleC::sprayStateGhosts(const int amr_ncycle)
     return 0;
   }
   int finest_level = parent->finestLevel();
-  return SprayParticleContainer::getStateGhostCells(
-    level, finest_level, amr_ncycle);
+  // The particles travel up to spray_max_substeps times as far in a gas step
+  return spray_max_substeps * SprayParticleContainer::getStateGhostCells(
+                                level, finest_level, amr_ncycle);
+}
+
+int
+PeleC::spraySubsteps(const amrex::Real dt)
+{
+  if (spray_max_substeps <= 1) {
+    return 1;
+  }
+  // The particles have moved since the gas step was chosen, so their time
+  // step is estimated again
+  const amrex::Real dt_particle = SprayPC->estTimestep(level);
+  if (dt_particle <= 0.0 || dt <= dt_particle) {
+    return 1;
+  }
+  const int nsub = static_cast<int>(std::ceil(dt / dt_particle));
+  return amrex::min(nsub, spray_max_substeps);
+}
+
+void
+PeleC::sprayMoveKickDrift(
+  const amrex::Real time, const amrex::Real dt, const int amr_ncycle)
+{
+  const int finest_level = parent->finestLevel();
+  const int spray_state_ghosts = sprayStateGhosts(amr_ncycle);
+  const int spray_source_ghosts = tmp_spray_source.nGrow();
+  auto const* ltransparm = PeleC::trans_parms.device_parm();
+
+  // Do the valid particles themselves
+  SprayPC->moveKickDrift(
+    Sborder, tmp_spray_source, level, dt, time, false, false,
+    spray_state_ghosts, spray_source_ghosts, true, ltransparm);
+
+  // Only need the coarsest virtual particles here.
+  if (level < finest_level) {
+    VirtPC->moveKickDrift(
+      Sborder, tmp_spray_source, level, dt, time, true, false,
+      spray_state_ghosts, spray_source_ghosts, true, ltransparm);
+  }
+
+  // Miiiight need all Ghosts
+  if (GhostPC != nullptr && level != 0) {
+    GhostPC->moveKickDrift(
+      Sborder, tmp_spray_source, level, dt, time, false, true,
+      spray_state_ghosts, spray_source_ghosts, true, ltransparm);
+  }
+}
+
+void
+PeleC::sprayMoveKick(
+  const amrex::Real time, const amrex::Real dt, const int amr_ncycle)
+{
+  const int spray_state_ghosts = sprayStateGhosts(amr_ncycle);
+  const int spray_source_ghosts = tmp_spray_source.nGrow();
+  auto const* ltransparm = PeleC::trans_parms.device_parm();
+
+  SprayPC->moveKick(
+    Sborder, tmp_spray_source, level, dt, time, false, false,
+    spray_state_ghosts, spray_source_ghosts, ltransparm);
+
+  if (level < parent->finestLevel()) {
+    VirtPC->moveKick(
+      Sborder, tmp_spray_source, level, dt, time, true, false,
+      spray_state_ghosts, spray_source_ghosts, ltransparm);
+  }
+
+  if (GhostPC != nullptr && level != 0) {
+    GhostPC->moveKick(
+      Sborder, tmp_spray_source, level, dt, time, false, true,
+      spray_state_ghosts, spray_source_ghosts, ltransparm);
+  }
 }
 
 void
 PeleC::defineSpraySource(const int amr_ncycle)
 {
   int finest_level = parent->finestLevel();
-  int spray_source_ghosts = SprayParticleContainer::getSourceGhostCells(
-    level, finest_level, amr_ncycle);
+  int spray_source_ghosts =
+    spray_max_substeps * SprayParticleContainer::getSourceGhostCells(
+                           level, finest_level, amr_ncycle);
   // We must make a temporary spray source term to ensure number of ghost
   // cells are correct
   tmp_spray_source.define(
@@ -114,11 +289,16 @@ PeleC::setupVirtualParticles(const int level, const int finest_level)
   if (SprayPC != nullptr && !virtual_particles_set) {
     if (level < finest_level) {
       SprayParticleContainer::AoS virts;
+      SprayParticleContainer::AoS fine_virts;
       setupVirtualParticles(level + 1, finest_level);
-      VirtPC->CreateVirtualParticles(level + 1, virts);
-      VirtPC->AddParticlesAtLevel(virts, level);
-
+      VirtPC->CreateVirtualParticles(level + 1, fine_virts);
       SprayPC->CreateVirtualParticles(level + 1, virts);
+
+      // Adding the particles redistributes the container, so the virtual
+      // particles of both containers are added at once
+      auto& vec = virts();
+      const auto& fine_vec = fine_virts();
+      vec.insert(vec.end(), fine_vec.begin(), fine_vec.end());
       VirtPC->AddParticlesAtLevel(virts, level);
     }
     virtual_particles_set = true;
@@ -211,8 +391,25 @@ PeleC::particleMKD(
   if (sub_iteration != 0) {
     return;
   }
+  const amrex::Real wt = amrex::ParallelDescriptor::second();
   old_sources[spray_src]->setVal(0.);
   tmp_spray_source.setVal(0.);
+
+  // Particles drift out of cell order as they move; once too many are out
+  // of order, sort them so that the interpolation from the state and the
+  // deposition of the sources access memory contiguously
+  if (spray_sort_disorder >= 0.0) {
+    const amrex::Real disorder = sprayDisorder(*SprayPC, level);
+    if (disorder > spray_sort_disorder) {
+      if (particle_verbose >= 1) {
+        amrex::Print() << "Sorting spray particles by cell, " << disorder
+                       << " out of order at level " << level << '\n';
+      }
+      BL_PROFILE("PeleC::sortSprayParticles()");
+      SprayPC->SortParticlesByCell();
+    }
+  }
+
   // Setup ghost particles for use in finer levels. Note that ghost
   // particles that will be used by this level have already been created,
   // the particles being set here are only used by finer levels.
@@ -236,37 +433,71 @@ PeleC::particleMKD(
     amrex::Print()
       << "moveKickDrift ... updating particle positions and velocity\n";
   }
-  const int spray_state_ghosts = sprayStateGhosts(amr_ncycle);
   const int spray_source_ghosts = tmp_spray_source.nGrow();
-  auto const* ltransparm = PeleC::trans_parms.device_parm();
   // We will make a temporary copy of the source term array inside
   // moveKickDrift and we are only going to use the spray force out to one ghost
   // cell so we need only define spray_force_old with one ghost cell
 
   AMREX_ASSERT(old_sources[spray_src]->nGrow() >= 1);
 
-  // Do the valid particles themselves
-  SprayPC->moveKickDrift(
-    Sborder, tmp_spray_source, level, dt, time, false, false,
-    spray_state_ghosts, spray_source_ghosts, true, ltransparm);
-
-  // Only need the coarsest virtual particles here.
-  if (level < finest_level) {
-    VirtPC->moveKickDrift(
-      Sborder, tmp_spray_source, level, dt, time, true, false,
-      spray_state_ghosts, spray_source_ghosts, true, ltransparm);
-  }
-
-  // Miiiight need all Ghosts
-  if (GhostPC != nullptr && level != 0) {
-    GhostPC->moveKickDrift(
-      Sborder, tmp_spray_source, level, dt, time, false, true,
-      spray_state_ghosts, spray_source_ghosts, true, ltransparm);
+  // transferSource writes the spray source with the state layout, so it is
+  // deposited on the whole state before keeping the footprint of spray_src
+  auto& spray_old = *old_sources[spray_src];
+  amrex::MultiFab spray_full(
+    grids, dmap, NVAR, spray_old.nGrow(), amrex::MFInfo(), Factory());
+  spray_full.setVal(0.);
+  const int nsub = spraySubsteps(dt);
+  spray_nsub = nsub;
+  spray_substep_dt = dt / nsub;
+  if (nsub == 1) {
+    sprayMoveKickDrift(time, dt, amr_ncycle);
+    // Must call transfer source after moveKick and moveKickDrift
+    // on all particle types
+    SprayPC->transferSource(
+      spray_source_ghosts, level, tmp_spray_source, spray_full);
+  } else {
+    // Sub-cycle the particles in the gas state at the start of the step. The
+    // old source is the mean of the sources deposited at the start of each
+    // substep and the new source the mean of those deposited at their end,
+    // the last of which is deposited by particleMK
+    if (particle_verbose >= 1) {
+      amrex::Print() << "Sub-cycling spray particles with " << nsub
+                     << " substeps at level " << level << '\n';
+    }
+    const int ng_new = new_sources[spray_src]->nGrow();
+    spray_new_full.define(
+      grids, dmap, NVAR, ng_new, amrex::MFInfo(), Factory());
+    spray_new_full.setVal(0.);
+    amrex::MultiFab substep_source(
+      grids, dmap, NVAR, amrex::max(spray_old.nGrow(), ng_new),
+      amrex::MFInfo(), Factory());
+    const int nGrow = sprayStateGhosts(amr_ncycle);
+    for (int isub = 0; isub < nsub; isub++) {
+      const amrex::Real subtime = time + isub * spray_substep_dt;
+      tmp_spray_source.setVal(0.);
+      sprayMoveKickDrift(subtime, spray_substep_dt, amr_ncycle);
+      substep_source.setVal(0.);
+      SprayPC->transferSource(
+        spray_source_ghosts, level, tmp_spray_source, substep_source);
+      amrex::MultiFab::Saxpy(
+        spray_full, 1.0 / nsub, substep_source, 0, 0, NVAR,
+        spray_old.nGrow());
+      if (isub < nsub - 1) {
+        tmp_spray_source.setVal(0.);
+        sprayMoveKick(
+          subtime + spray_substep_dt, spray_substep_dt, amr_ncycle);
+        substep_source.setVal(0.);
+        SprayPC->transferSource(
+          spray_source_ghosts, level, tmp_spray_source, substep_source);
+        amrex::MultiFab::Saxpy(
+          spray_new_full, 1.0 / nsub, substep_source, 0, 0, NVAR, ng_new);
+        // Keep the particles on this level until the end of its step
+        SprayPC->Redistribute(level, level, nGrow);
+      }
+    }
   }
-  // Must call transfer source after moveKick and moveKickDrift
-  // on all particle types
-  SprayPC->transferSource(
-    spray_source_ghosts, level, tmp_spray_source, *old_sources[spray_src]);
+  pack_source(spray_full, spray_old, spray_src, spray_old.nGrow());
+  addParticleWorkEstimate(amrex::ParallelDescriptor::second() - wt);
 }
 
 void
@@ -280,30 +511,33 @@ PeleC::particleMK(
   if (sub_iteration != sub_ncycle - 1 && sub_ncycle != 0) {
     return;
   }
-  const int spray_state_ghosts = sprayStateGhosts(amr_ncycle);
+  const amrex::Real wt = amrex::ParallelDescriptor::second();
   const int spray_source_ghosts = tmp_spray_source.nGrow();
   new_sources[spray_src]->setVal(0.);
-  auto const* ltransparm = PeleC::trans_parms.device_parm();
   if (particle_verbose >= 1) {
     amrex::Print() << "moveKick ... updating velocity only\n";
   }
-  SprayPC->moveKick(
-    Sborder, tmp_spray_source, level, dt, time, false, false,
-    spray_state_ghosts, spray_source_ghosts, ltransparm);
-
-  if (level < parent->finestLevel()) {
-    VirtPC->moveKick(
-      Sborder, tmp_spray_source, level, dt, time, true, false,
-      spray_state_ghosts, spray_source_ghosts, ltransparm);
-  }
-
-  if (GhostPC != nullptr && level != 0) {
-    GhostPC->moveKick(
-      Sborder, tmp_spray_source, level, dt, time, false, true,
-      spray_state_ghosts, spray_source_ghosts, ltransparm);
-  }
+  // Complete the last particle substep of the step
+  const amrex::Real dt_kick = (spray_substep_dt > 0.0) ? spray_substep_dt : dt;
+  sprayMoveKick(time, dt_kick, amr_ncycle);
+
+  auto& spray_new = *new_sources[spray_src];
+  amrex::MultiFab spray_full(
+    grids, dmap, NVAR, spray_new.nGrow(), amrex::MFInfo(), Factory());
+  spray_full.setVal(0.);
   SprayPC->transferSource(
-    spray_source_ghosts, level, tmp_spray_source, *new_sources[spray_src]);
+    spray_source_ghosts, level, tmp_spray_source, spray_full);
+  if (spray_nsub > 1) {
+    // Add the end of the last substep to the mean of the earlier ones
+    amrex::MultiFab::Saxpy(
+      spray_new_full, 1.0 / spray_nsub, spray_full, 0, 0, NVAR,
+      spray_new.nGrow());
+    pack_source(spray_new_full, spray_new, spray_src, spray_new.nGrow());
+    spray_new_full.clear();
+  } else {
+    pack_source(spray_full, spray_new, spray_src, spray_new.nGrow());
+  }
+  addParticleWorkEstimate(amrex::ParallelDescriptor::second() - wt);
 }
 
 void
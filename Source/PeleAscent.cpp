@@ -1,5 +1,8 @@
 #include <AMReX_ParmParse.H>
+#include <AMReX_Conduit_Blueprint.H>
+#include <AMReX_GpuDevice.H>
 #include "PeleAscent.H"
+#include "Telemetry.H"
 
 namespace pele {
 PeleAscent::PeleAscent()
@@ -7,6 +10,156 @@ PeleAscent::PeleAscent()
   {
     amrex::ParmParse pp("ascent");
     pp.query("plot_int", plot_int);
+    pp.query("async", async);
   }
 }
+
+PeleAscent::~PeleAscent() { finalize(); }
+
+void
+PeleAscent::open()
+{
+  conduit::Node open_opts;
+  m_threaded = async;
+#ifdef AMREX_USE_MPI
+  // Ascent gets its own communicator so that its messages never match those
+  // of the solver while it renders concurrently
+  MPI_Comm_dup(amrex::ParallelDescriptor::Communicator(), &m_comm);
+  open_opts["mpi_comm"] = MPI_Comm_c2f(m_comm);
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  if (
+    m_threaded && (provided < MPI_THREAD_MULTIPLE) &&
+    (amrex::ParallelDescriptor::NProcs() > 1)) {
+    amrex::Print() << "Warning: MPI_THREAD_MULTIPLE is not available, "
+                   << "Ascent renders synchronously" << std::endl;
+    m_threaded = false;
+  }
+#endif
+  m_ascent.open(open_opts);
+  m_open = true;
+}
+
+bool
+PeleAscent::sameLayout(
+  const amrex::Vector<std::unique_ptr<amrex::MultiFab>>& plotMFs,
+  const amrex::Vector<std::string>& plt_var_names) const
+{
+  if (
+    (plotMFs.size() != m_staging.size()) || (plt_var_names != m_var_names)) {
+    return false;
+  }
+  for (int lev = 0; lev < plotMFs.size(); ++lev) {
+    if (
+      (plotMFs[lev]->boxArray() != m_staging[lev]->boxArray()) ||
+      (plotMFs[lev]->DistributionMap() != m_staging[lev]->DistributionMap())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void
+PeleAscent::render(
+  amrex::Vector<std::unique_ptr<amrex::MultiFab>>& plotMFs,
+  const amrex::Vector<std::string>& plt_var_names,
+  const amrex::Vector<amrex::Geometry>& geoms,
+  const amrex::Real time,
+  const amrex::Vector<int>& istep,
+  const amrex::Vector<amrex::IntVect>& ref_ratio)
+{
+  BL_PROFILE("PeleAscent::render()");
+
+  // The staging data is still read by the render in flight
+  wait();
+
+  if (!m_open) {
+    open();
+  }
+
+  const int nlevels = static_cast<int>(plotMFs.size());
+  if (sameLayout(plotMFs, plt_var_names)) {
+    // The cached mesh references the staging data, only refresh its content
+    for (int lev = 0; lev < nlevels; ++lev) {
+      amrex::MultiFab::Copy(
+        *m_staging[lev], *plotMFs[lev], 0, 0, plotMFs[lev]->nComp(), 0);
+    }
+    for (conduit::index_t d = 0; d < m_mesh.number_of_children(); ++d) {
+      conduit::Node& dom = m_mesh.child(d);
+      const int lev =
+        dom.has_path("state/level") ? dom["state/level"].to_int() : 0;
+      dom["state/time"] = time;
+      dom["state/cycle"] = istep[lev];
+    }
+  } else {
+    // Take over the plot data as the new staging area and rebuild the mesh
+    m_staging = std::move(plotMFs);
+    m_var_names = plt_var_names;
+    amrex::Vector<const amrex::MultiFab*> staging_constvec;
+    staging_constvec.reserve(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+      staging_constvec.push_back(m_staging[lev].get());
+    }
+    m_mesh.reset();
+    amrex::MultiLevelToBlueprint(
+      nlevels, staging_constvec, m_var_names, geoms, time, istep, ref_ratio,
+      m_mesh);
+
+    conduit::Node verify_info;
+    if (!conduit::blueprint::mesh::verify(m_mesh, verify_info)) {
+      ASCENT_INFO("Error: Mesh Blueprint Verify Failed!");
+      verify_info.print();
+    }
+  }
+
+  // The copies into the staging data may still run on the device stream,
+  // which Ascent does not wait for
+  amrex::Gpu::streamSynchronize();
+  if (m_threaded) {
+    m_worker = std::thread(&PeleAscent::execute, this);
+  } else {
+    execute();
+  }
+}
+
+void
+PeleAscent::execute()
+{
+  m_ascent.publish(m_mesh);
+  m_ascent.execute(m_actions);
+}
+
+void
+PeleAscent::wait()
+{
+  if (m_worker.joinable()) {
+    BL_PROFILE("PeleAscent::wait()");
+    m_worker.join();
+  }
+}
+
+void
+PeleAscent::finalize()
+{
+  wait();
+  if (m_open) {
+    m_ascent.close();
+    m_open = false;
+#ifdef AMREX_USE_MPI
+    MPI_Comm_free(&m_comm);
+#endif
+  }
+  m_staging.clear();
+  m_mesh.reset();
+}
+
+amrex::Long
+PeleAscent::stagingBytes() const
+{
+  amrex::Long nbytes = 0;
+  for (const auto& mf : m_staging) {
+    nbytes += Telemetry::bytes(*mf);
+  }
+  return nbytes;
+}
 } // namespace pele
@@ -85,6 +85,7 @@ int PeleC::les_filter_type = no_filter;
 int PeleC::les_filter_fgr = 1;
 int PeleC::les_test_filter_type = box_3pt_optimized_approx;
 int PeleC::les_test_filter_fgr = 2;
+int PeleC::les_coeff_int = 1;
 
 bool PeleC::eb_in_domain = false;
 bool PeleC::eb_initialized = false;
@@ -108,6 +109,9 @@ pele::physics::turbinflow::TurbInflow PeleC::turb_inflow;
 amrex::Vector<std::string> PeleC::m_diagVars;
 
 amrex::Vector<int> PeleC::src_list;
+amrex::Vector<std::string> PeleC::stats_vars;
+amrex::Vector<int> PeleC::stats_pairs;
+std::unique_ptr<pele::Probes> PeleC::probes;
 
 // this will be reset upon restart
 amrex::Real PeleC::previousCPUTimeUsed = 0.0;
@@ -343,6 +347,31 @@ PeleC::read_params()
                    << std::endl;
   }
 
+  if (add_forcing_src) {
+    if (forcing_type != "linear" && forcing_type != "lundgren") {
+      amrex::Abort("Unknown pelec.forcing_type: " + forcing_type);
+    }
+    if (forcing_type == "lundgren" && forcing_eps0 <= 0.0) {
+      amrex::Abort("pelec.forcing_eps0 must be positive for lundgren forcing");
+    }
+  }
+
+  if (bc_cache != "none" && bc_cache != "steady" && bc_cache != "periodic") {
+    amrex::Abort("Unknown pelec.bc_cache: " + bc_cache);
+  }
+  if (bc_cache == "periodic" && bc_cache_period <= 0.0) {
+    amrex::Abort("pelec.bc_cache_period must be positive for bc_cache = "
+                 "periodic");
+  }
+  if (bc_cache == "periodic" && bc_cache_nphases <= 0) {
+    amrex::Abort("pelec.bc_cache_nphases must be positive for bc_cache = "
+                 "periodic");
+  }
+  if (bc_cache != "none" && turb_inflow.is_initialized()) {
+    // The cached values would freeze the turbulent fluctuations
+    amrex::Abort("pelec.bc_cache cannot be used with TurbInflow");
+  }
+
   if ((do_les || use_explicit_filter) && (AMREX_SPACEDIM != 3)) {
     amrex::Abort("Using LES/filtering currently requires 3d.");
   }
@@ -351,6 +380,7 @@ PeleC::read_params()
     pp.query("les_model", les_model);
     pp.query("les_test_filter_type", les_test_filter_type);
     pp.query("les_test_filter_fgr", les_test_filter_fgr);
+    pp.query("les_coeff_int", les_coeff_int);
   }
 
   if (use_explicit_filter) {
@@ -465,13 +495,14 @@ PeleC::PeleC(
   for (int src : src_list) {
     int oldGrow = numGrow();
     int newGrow = S_new.nGrow();
+    const int ncomp = source_footprint(src).size();
     old_sources[src] = std::make_unique<amrex::MultiFab>(
-      grids, dmap, NVAR, oldGrow, amrex::MFInfo(), Factory());
+      grids, dmap, ncomp, oldGrow, amrex::MFInfo(), Factory());
     new_sources[src] = std::make_unique<amrex::MultiFab>(
-      grids, dmap, NVAR, newGrow, amrex::MFInfo(), Factory());
+      grids, dmap, ncomp, newGrow, amrex::MFInfo(), Factory());
   }
 
-  int nGrowS = numGrow();
+  int nGrowS = numGrow() + nGrowDeepHalo();
 #ifdef PELE_USE_SPRAY
   if (do_spray_particles) {
     if (level > 0) {
@@ -546,6 +577,8 @@ PeleC::PeleC(
 
   // initialize diagnostics (only level 0 calls them)
   init_diagnostics();
+
+  record_memory();
 }
 
 PeleC::~PeleC()
@@ -553,6 +586,50 @@ PeleC::~PeleC()
   if (do_react) {
     close_reactor();
   }
+  pele::Telemetry::clearLevelMemory(this);
+}
+
+void
+PeleC::record_memory()
+{
+  using pele::Telemetry;
+
+  amrex::Long state_bytes = 0;
+  for (int typ = 0; typ < desc_lst.size(); ++typ) {
+    if (state[typ].hasOldData()) {
+      state_bytes += Telemetry::bytes(state[typ].oldData());
+    }
+    if (state[typ].hasNewData()) {
+      state_bytes += Telemetry::bytes(state[typ].newData());
+    }
+  }
+
+  amrex::Long source_bytes = 0;
+  for (const auto& srcs : {&old_sources, &new_sources}) {
+    for (const auto& src_mf : *srcs) {
+      if (src_mf != nullptr) {
+        source_bytes += Telemetry::bytes(*src_mf);
+      }
+    }
+  }
+
+  amrex::Long geometry_bytes =
+    Telemetry::bytes(volume) + Telemetry::bytes(vfrac);
+  for (const auto& a : area) {
+    geometry_bytes += Telemetry::bytes(a);
+  }
+
+  Telemetry::setLevelMemory(this, Telemetry::mem_state, state_bytes);
+  Telemetry::setLevelMemory(
+    this, Telemetry::mem_sborder, Telemetry::bytes(Sborder));
+  Telemetry::setLevelMemory(
+    this, Telemetry::mem_hydro_sources,
+    Telemetry::bytes(hydro_source) + Telemetry::bytes(sources_for_hydro));
+  Telemetry::setLevelMemory(this, Telemetry::mem_sources, source_bytes);
+  Telemetry::setLevelMemory(
+    this, Telemetry::mem_les,
+    Telemetry::bytes(LES_Coeffs) + Telemetry::bytes(filtered_les_source));
+  Telemetry::setLevelMemory(this, Telemetry::mem_geometry, geometry_bytes);
 }
 
 void
@@ -590,15 +667,17 @@ PeleC::buildMetrics()
     }
   }
 
+  // The deep halo predictor computes fluxes on the extra ghost cells as well
+  const int nGrowM = numGrow() + nGrowDeepHalo();
   volume.clear();
   volume.define(
-    grids, dmap, 1, numGrow(), amrex::MFInfo(), amrex::FArrayBoxFactory());
+    grids, dmap, 1, nGrowM, amrex::MFInfo(), amrex::FArrayBoxFactory());
   geom.GetVolume(volume);
 
   for (int dir = 0; dir < AMREX_SPACEDIM; dir++) {
     area[dir].clear();
     area[dir].define(
-      getEdgeBoxArray(dir), dmap, 1, numGrow(), amrex::MFInfo(),
+      getEdgeBoxArray(dir), dmap, 1, nGrowM, amrex::MFInfo(),
       amrex::FArrayBoxFactory());
     geom.GetFaceArea(area[dir], dir);
   }
@@ -721,6 +800,8 @@ PeleC::initData()
     get_new_data(Work_Estimate_Type).setVal(1.0);
   }
 
+  get_new_data(Stats_Type).setVal(0.0);
+
   if (init_pltfile.empty()) {
     const auto geomdata = geom.data();
     const ProbParmDevice* lprobparm = d_prob_parm_device;
@@ -790,6 +871,16 @@ PeleC::init(AmrLevel& old)
       old, work_estimate_new, 0, cur_time, Work_Estimate_Type, 0,
       work_estimate_new.nComp());
   }
+
+  amrex::MultiFab& stats_new = get_new_data(Stats_Type);
+  if (doStats()) {
+    FillPatch(old, stats_new, 0, cur_time, Stats_Type, 0, stats_new.nComp());
+  } else {
+    stats_new.setVal(0.0);
+  }
+
+  // The old level is still alive, so both count towards the regrid peak
+  record_memory();
 }
 
 void
@@ -816,6 +907,15 @@ PeleC::init()
     FillCoarsePatch(
       work_estimate_new, 0, cur_time, Work_Estimate_Type, 0, ncomp);
   }
+
+  amrex::MultiFab& stats_new = get_new_data(Stats_Type);
+  if (doStats()) {
+    FillCoarsePatch(stats_new, 0, cur_time, Stats_Type, 0, stats_new.nComp());
+  } else {
+    stats_new.setVal(0.0);
+  }
+
+  record_memory();
 }
 
 amrex::Real
@@ -841,6 +941,7 @@ PeleC::estTimeStep(amrex::Real /*dt_old*/)
   BL_PROFILE("PeleC::estTimeStep()");
 
   if (fixed_dt > 0.0) {
+    pele::Telemetry::setDtLimiter(level, "pelec.fixed_dt");
     return fixed_dt;
   }
 
@@ -966,6 +1067,7 @@ PeleC::estTimeStep(amrex::Real /*dt_old*/)
     amrex::Print() << "PeleC::estTimeStep (" << limiter << "-limited) at level "
                    << level << ":  estdt = " << estdt << '\n';
   }
+  pele::Telemetry::setDtLimiter(level, limiter);
 
   return estdt;
 }
@@ -1015,6 +1117,9 @@ PeleC::computeNewDt(
                            << " * " << dt_level[i] << '\n';
           }
         }
+        if (dt_min[i] > change_max * dt_level[i]) {
+          pele::Telemetry::setDtLimiter(i, "pelec.change_max");
+        }
         dt_min[i] =
           amrex::min<amrex::Real>(dt_min[i], change_max * dt_level[i]);
       }
@@ -1041,6 +1146,19 @@ PeleC::computeNewDt(
     n_factor *= n_cycle[i];
     dt_level[i] = dt_0 / n_factor;
   }
+
+  // Interpolate the turbulent inflow at the end of the first step of each
+  // level while the step starts; the fills at other times, or after a
+  // regrid, interpolate it when needed as before
+  if (turb_inflow.is_initialized() && turb_inflow_prefetch) {
+    amrex::Vector<std::pair<amrex::Box, amrex::Real>> domain_times;
+    for (int i = 0; i <= finest_level; i++) {
+      domain_times.emplace_back(
+        getLevel(i).Domain(),
+        getLevel(i).state[State_Type].curTime() + dt_level[i]);
+    }
+    pc_bcfill_prefetch_turb(domain_times);
+  }
 }
 
 void
@@ -1124,6 +1242,33 @@ PeleC::post_timestep(int iteration)
 
   problem_post_timestep();
 
+  if (level == 0 && doStats()) {
+    const amrex::Real cumtime = parent->cumTime() + parent->dtLevel(0);
+    if (
+      (cumtime >= stats_start) &&
+      (parent->levelSteps(0) % amrex::max(stats_int, 1) == 0)) {
+      accumulate_stats(cumtime);
+    }
+  }
+
+  if (level == 0 && probes && probes->doSample(parent->levelSteps(0))) {
+    pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::io);
+    amrex::Vector<const amrex::MultiFab*> state_all(finest_level + 1);
+    amrex::Vector<amrex::Geometry> geom_all(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      state_all[lev] = &getLevel(lev).get_new_data(State_Type);
+      geom_all[lev] = getLevel(lev).Geom();
+    }
+    probes->sample(
+      state_all, geom_all, parent->levelSteps(0),
+      parent->cumTime() + parent->dtLevel(0));
+  }
+
+  record_memory();
+  if (level == 0 && verbose > 1) {
+    pele::Telemetry::printMemory();
+  }
+
   if (level == 0) {
     int nstep = parent->levelSteps(0);
     amrex::Real dtlev = parent->dtLevel(0);
@@ -1282,6 +1427,8 @@ PeleC::post_restart()
   init_diagnostics();
 
   problem_post_restart();
+
+  record_memory();
 }
 
 void
@@ -1296,6 +1443,9 @@ PeleC::post_regrid(int lbase, int /*new_finest*/)
 {
   BL_PROFILE("PeleC::post_regrid()");
   fine_mask.clear();
+  if (lbase == level) {
+    pc_bcfill_clear_cache();
+  }
 
 #ifdef PELE_USE_SPRAY
   if (lbase == level) {
@@ -1308,6 +1458,8 @@ PeleC::post_regrid(int lbase, int /*new_finest*/)
   if ((do_react) && (use_typical_vals_chem)) {
     set_typical_values_chem();
   }
+
+  record_memory();
 }
 
 void
@@ -1329,6 +1481,8 @@ PeleC::post_init(amrex::Real /*stop_time*/)
     react_state(cumtime, dtlev, react_init);
   }
 
+  record_memory();
+
   if (level > 0) {
     return;
   }
@@ -1577,7 +1731,10 @@ void
 PeleC::allocOldData()
 {
   for (int k = 0; k < num_state_type; k++) {
-    state[k].allocOldData();
+    // The statistics have no old time level
+    if (k != Stats_Type) {
+      state[k].allocOldData();
+    }
   }
 }
 
@@ -2046,6 +2203,20 @@ PeleC::init_les()
     LES_Coeffs.setVal(PrT, comp_PrT, 1, LES_Coeffs.nGrow());
   }
 
+  // The dynamic model computes its test filtered quantities from Sborder,
+  // which needs enough ghost cells for the diffusion operator (1), both
+  // filters and the face values (1)
+  les_coeffs_step = -1;
+  if (les_model == 1) {
+    les_test_filter = Filter(les_test_filter_type, les_test_filter_fgr);
+    les_coeff_filter = Filter(box, 6);
+    nGrowDLES = 2 + les_coeff_filter.get_filter_ngrow() +
+                les_test_filter.get_filter_ngrow();
+    if (Sborder.nGrow() < nGrowDLES) {
+      Sborder.define(grids, dmap, NVAR, nGrowDLES, amrex::MFInfo(), Factory());
+    }
+  }
+
   amrex::Print() << "WARNING: LES with Fuego assumes Cp is a weak function of T"
                  << std::endl;
 #if NUM_SPECIES > 2
@@ -2073,6 +2244,7 @@ PeleC::init_filters()
   }
 
   nGrowF = les_filter.get_filter_ngrow();
+  les_fused_filter = FusedFilter(les_filter);
 
   // Add grow cells necessary for explicit filtering of source terms
   if (do_hydro) {
@@ -2164,54 +2336,23 @@ PeleC::init_mms()
 #endif
 
 void
-PeleC::reset_internal_energy(amrex::MultiFab& S_new, int ng)
+PeleC::computeTemp(amrex::MultiFab& S, int ng)
 {
 #ifndef AMREX_USE_GPU
   amrex::Real sum0 = 0.0;
   if (parent->finestLevel() == 0 && print_energy_diagnostics) {
     // Pass in the multifab and the component
-    sum0 = volWgtSumMF(S_new, Eden, true);
-  }
-#endif
-
-  // Ensure (rho e) isn't too small or negative
-  {
-    const auto captured_allow_small_energy = allow_small_energy;
-    const auto captured_allow_negative_energy = allow_negative_energy;
-    const auto captured_dual_energy_update_E_from_e =
-      dual_energy_update_E_from_e;
-    const auto captured_verbose = verbose;
-    const auto captured_dual_energy_eta2 = dual_energy_eta2;
-    auto sarrs = S_new.arrays();
-    const amrex::IntVect ngs(ng);
-    amrex::ParallelFor(
-      S_new, ngs, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-        pc_rst_int_e(
-          i, j, k, sarrs[nbx], captured_allow_small_energy,
-          captured_allow_negative_energy, captured_dual_energy_update_E_from_e,
-          captured_dual_energy_eta2, captured_verbose);
-      });
-    amrex::Gpu::synchronize();
-  }
-
-#ifndef AMREX_USE_GPU
-  if (parent->finestLevel() == 0 && print_energy_diagnostics) {
-    // Pass in the multifab and the component
-    amrex::Real sum = volWgtSumMF(S_new, Eden, true);
-    amrex::ParallelDescriptor::ReduceRealSum(sum0);
-    amrex::ParallelDescriptor::ReduceRealSum(sum);
-    if (amrex::ParallelDescriptor::IOProcessor() && std::abs(sum - sum0) > 0) {
-      amrex::Print() << "(rho E) added from reset terms                 : "
-                     << sum - sum0 << " out of " << sum0 << std::endl;
-    }
+    sum0 = volWgtSumMF(S, Eden, true);
   }
 #endif
-}
 
-void
-PeleC::computeTemp(amrex::MultiFab& S, int ng)
-{
-  reset_internal_energy(S, ng);
+  // Ensure (rho e) isn't too small or negative, then invert it for the
+  // temperature in the same sweep
+  const auto captured_allow_small_energy = allow_small_energy;
+  const auto captured_allow_negative_energy = allow_negative_energy;
+  const auto captured_dual_energy_update_E_from_e = dual_energy_update_E_from_e;
+  const auto captured_verbose = verbose;
+  const auto captured_dual_energy_eta2 = dual_energy_eta2;
 
   auto const& fact =
     dynamic_cast<amrex::EBFArrayBoxFactory const&>(S.Factory());
@@ -2222,11 +2363,28 @@ PeleC::computeTemp(amrex::MultiFab& S, int ng)
   const amrex::IntVect ngs(ng);
   amrex::ParallelFor(
     S, ngs, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+      pc_rst_int_e(
+        i, j, k, sarrs[nbx], captured_allow_small_energy,
+        captured_allow_negative_energy, captured_dual_energy_update_E_from_e,
+        captured_dual_energy_eta2, captured_verbose);
       if (!flagarrs[nbx](i, j, k).isCovered()) {
         pc_cmpTemp(i, j, k, sarrs[nbx]);
       }
     });
   amrex::Gpu::synchronize();
+
+#ifndef AMREX_USE_GPU
+  if (parent->finestLevel() == 0 && print_energy_diagnostics) {
+    // Pass in the multifab and the component
+    amrex::Real sum = volWgtSumMF(S, Eden, true);
+    amrex::ParallelDescriptor::ReduceRealSum(sum0);
+    amrex::ParallelDescriptor::ReduceRealSum(sum);
+    if (amrex::ParallelDescriptor::IOProcessor() && std::abs(sum - sum0) > 0) {
+      amrex::Print() << "(rho E) added from reset terms                 : "
+                     << sum - sum0 << " out of " << sum0 << std::endl;
+    }
+  }
+#endif
 }
 
 amrex::Real
@@ -1,5 +1,20 @@
+#include <fstream>
+#include <iomanip>
+
 #include "PeleCAmr.H"
 
+namespace {
+amrex::Long
+plotMFBytes(const amrex::Vector<std::unique_ptr<amrex::MultiFab>>& plotMFs)
+{
+  amrex::Long nbytes = 0;
+  for (const auto& mf : plotMFs) {
+    nbytes += pele::Telemetry::bytes(*mf);
+  }
+  return nbytes;
+}
+} // namespace
+
 #ifdef PELE_USE_SPRAY
 #include "SprayParticles.H"
 #endif
@@ -225,12 +240,15 @@ PeleCAmr::writePlotFileDoit(
   const bool write_hdf5_plots,
   const std::string& hdf5_compression)
 {
+  pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::io);
   auto dPlotFileTime0 = amrex::second();
 
   const int nlevels = finestLevel() + 1;
   amrex::Vector<std::string> plt_var_names;
   amrex::Vector<std::unique_ptr<amrex::MultiFab>> plotMFs(nlevels);
   constructPlotMF(regular, plotMFs, plt_var_names);
+  pele::Telemetry::ScopedMemory telemetry_memory(
+    pele::Telemetry::mem_plot, plotMFBytes(plotMFs));
 
   amrex::Vector<const amrex::MultiFab*> plotMFs_constvec;
   plotMFs_constvec.reserve(nlevels);
@@ -322,6 +340,102 @@ PeleCAmr::writePlotFileDoit(
   }
 }
 
+void
+PeleCAmr::regrid(int lbase, amrex::Real time, bool initial)
+{
+  pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::regrid);
+  amrex::Amr::regrid(lbase, time, initial);
+}
+
+void
+PeleCAmr::writeTelemetry(const amrex::Real step_time)
+{
+  if (PeleC::telemetryFile().empty()) {
+    // The counters are accumulated regardless, so they are cleared every
+    // step even when they are not written
+    pele::Telemetry::reset();
+    return;
+  }
+  BL_PROFILE("PeleCAmr::writeTelemetry()");
+
+  const int nlevels = finestLevel() + 1;
+  const int IOProc = amrex::ParallelDescriptor::IOProcessorNumber();
+
+  // Timings, RHS evaluations and Courant numbers are reduced in one call
+  const int nphases = pele::Telemetry::num_phases;
+  amrex::Vector<amrex::Real> rmax(nphases + 2 + nlevels, 0.0);
+  for (int p = 0; p < nphases; ++p) {
+    rmax[p] = pele::Telemetry::phaseTime(p);
+  }
+  rmax[nphases] = step_time;
+  rmax[nphases + 1] = pele::Telemetry::maxRHSEvals();
+  const auto& courno = pele::Telemetry::courant();
+  for (int lev = 0; lev < nlevels && lev < courno.size(); ++lev) {
+    rmax[nphases + 2 + lev] = courno[lev];
+  }
+  amrex::ParallelDescriptor::ReduceRealMax(rmax.data(), rmax.size(), IOProc);
+
+  auto fab_bytes_hwm = amrex::TotalBytesAllocatedInFabsHWM();
+  amrex::ParallelDescriptor::ReduceLongMax(fab_bytes_hwm, IOProc);
+  amrex::ResetTotalBytesAllocatedInFabsHWM();
+
+  const auto mem = pele::Telemetry::reduceMemory();
+  const int nmem = pele::Telemetry::num_memory;
+
+  amrex::Long nparticles = 0;
+#ifdef PELE_USE_SPRAY
+  if (PeleC::SprayPC != nullptr) {
+    nparticles = PeleC::SprayPC->TotalNumberOfParticles();
+  }
+#endif
+
+  if (amrex::ParallelDescriptor::IOProcessor()) {
+    // Cells updated in this coarse step, accounting for subcycling
+    amrex::Real cells_updated = 0.0;
+    int nsub = 1;
+    for (int lev = 0; lev < nlevels; ++lev) {
+      nsub *= nCycle(lev);
+      cells_updated += static_cast<amrex::Real>(nsub) *
+                       static_cast<amrex::Real>(boxArray(lev).numPts());
+    }
+    const amrex::Real cells_per_second = cells_updated / rmax[nphases];
+    const auto& limiters = pele::Telemetry::dtLimiters();
+
+    std::ofstream ofs(PeleC::telemetryFile(), std::ios::app);
+    if (!ofs.good()) {
+      amrex::FileOpenFailed(PeleC::telemetryFile());
+    }
+    ofs << std::setprecision(8) << "{\"step\": " << levelSteps(0)
+        << ", \"time\": " << cumTime() << ", \"step_time\": "
+        << rmax[nphases] << ", \"cells_per_second\": " << cells_per_second
+        << ", \"levels\": [";
+    for (int lev = 0; lev < nlevels; ++lev) {
+      ofs << (lev > 0 ? ", " : "") << "{\"level\": " << lev
+          << ", \"dt\": " << dtLevel(lev) << ", \"dt_limiter\": \""
+          << (lev < limiters.size() ? limiters[lev] : "") << "\""
+          << ", \"courant\": " << rmax[nphases + 2 + lev]
+          << ", \"cells\": " << boxArray(lev).numPts() << "}";
+    }
+    ofs << "], \"phase_time\": {";
+    for (int p = 0; p < nphases; ++p) {
+      ofs << (p > 0 ? ", " : "") << "\"" << pele::Telemetry::phaseName(p)
+          << "\": " << rmax[p];
+    }
+    ofs << "}, \"particles\": " << nparticles
+        << ", \"max_rhs_evals\": " << rmax[nphases + 1]
+        << ", \"fab_bytes_hwm\": " << fab_bytes_hwm << ", \"memory\": {";
+    for (int m = 0; m < nmem; ++m) {
+      ofs << "\"" << pele::Telemetry::memoryName(m)
+          << "\": {\"live\": " << mem[m] << ", \"peak\": " << mem[nmem + m]
+          << ", \"at_total_peak\": " << mem[2 * nmem + m] << "}, ";
+    }
+    ofs << "\"total\": {\"live\": " << mem[3 * nmem]
+        << ", \"peak\": " << mem[3 * nmem + 1] << "}}}" << std::endl;
+  }
+
+  pele::Telemetry::reset();
+}
+
 #ifdef AMREX_USE_ASCENT
 void
 PeleCAmr::doInSituViz(const int step)
@@ -341,19 +455,15 @@ PeleCAmr::doInSituViz(const int step)
     return;
   }
 
+  pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::io);
   auto dPlotFileTime0 = amrex::second();
 
   const int nlevels = finestLevel() + 1;
   amrex::Vector<std::string> plt_var_names;
   amrex::Vector<std::unique_ptr<amrex::MultiFab>> plotMFs(nlevels);
   constructPlotMF(true, plotMFs, plt_var_names);
-
-  amrex::Vector<const amrex::MultiFab*> plotMFs_constvec;
-  plotMFs_constvec.reserve(nlevels);
-  for (int lev = 0; lev < nlevels; ++lev) {
-    plotMFs_constvec.push_back(
-      static_cast<const amrex::MultiFab*>(plotMFs[lev].get()));
-  }
+  pele::Telemetry::ScopedMemory telemetry_memory(
+    pele::Telemetry::mem_plot, plotMFBytes(plotMFs));
 
   const amrex::Real cur_time =
     (amr_level[0]->get_state_data(State_Type)).curTime();
@@ -362,37 +472,17 @@ PeleCAmr::doInSituViz(const int step)
     istep[lev] = levelSteps(lev);
   }
 
-  conduit::Node bp_mesh;
-  amrex::MultiLevelToBlueprint(
-    nlevels, plotMFs_constvec, plt_var_names, Geom(), cur_time, istep,
-    refRatio(), bp_mesh);
-
-  ascent::Ascent ascent;
-  conduit::Node open_opts;
-
-#ifdef AMREX_USE_MPI
-  open_opts["mpi_comm"] =
-    MPI_Comm_c2f(amrex::ParallelDescriptor::Communicator());
-#endif
-  ascent.open(open_opts);
-  conduit::Node verify_info;
-  if (!conduit::blueprint::mesh::verify(bp_mesh, verify_info)) {
-    ASCENT_INFO("Error: Mesh Blueprint Verify Failed!");
-    verify_info.print();
-  }
-
-  conduit::Node actions;
-  ascent.publish(bp_mesh);
-
-  ascent.execute(actions);
-
-  ascent.close();
+  // Returns once the data is staged, rendering may still be in flight
+  pele_ascent.render(
+    plotMFs, plt_var_names, Geom(), cur_time, istep, refRatio());
+  pele::Telemetry::setMemory(
+    pele::Telemetry::mem_plot, pele_ascent.stagingBytes());
 
   if (verbose > 0) {
     const int IOProc = amrex::ParallelDescriptor::IOProcessorNumber();
     auto dPlotFileTime = amrex::second() - dPlotFileTime0;
     amrex::ParallelDescriptor::ReduceRealMax(dPlotFileTime, IOProc);
-    amrex::Print() << "Ascent write time = " << dPlotFileTime << "  seconds"
+    amrex::Print() << "Ascent staging time = " << dPlotFileTime << "  seconds"
                    << std::endl;
   }
 }
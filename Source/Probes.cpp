@@ -0,0 +1,368 @@
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+#include <AMReX_ParmParse.H>
+#include <AMReX_Utility.H>
+
+#include "Probes.H"
+
+namespace pele {
+
+namespace {
+template <class T>
+void
+append(amrex::Vector<char>& buffer, const T* data, const std::size_t n)
+{
+  const auto* bytes = reinterpret_cast<const char*>(data);
+  buffer.insert(buffer.end(), bytes, bytes + n * sizeof(T));
+}
+} // namespace
+
+Probes::Probes()
+{
+  amrex::ParmParse pp("probes");
+  pp.query("int", m_interval);
+  pp.query("dir", m_dir);
+  pp.query("buffer_size", m_buffer_size);
+  pp.getarr("vars", m_var_names);
+  amrex::Vector<std::string> names;
+  pp.getarr("names", names);
+  for (const auto& name : names) {
+    addProbe(name);
+  }
+
+  if (amrex::ParallelDescriptor::IOProcessor()) {
+    if (!amrex::UtilCreateDirectory(m_dir, 0755)) {
+      amrex::CreateDirectoryFailed(m_dir);
+    }
+    writeHeader();
+  }
+  amrex::ParallelDescriptor::Barrier();
+}
+
+Probes::~Probes() { finalize(); }
+
+bool
+Probes::defined()
+{
+  amrex::ParmParse pp("probes");
+  return pp.contains("names");
+}
+
+void
+Probes::addProbe(const std::string& name)
+{
+  amrex::ParmParse pp("probes." + name);
+  std::string type;
+  pp.get("type", type);
+
+  amrex::Vector<amrex::RealVect> points;
+  if (type == "point") {
+    amrex::Vector<amrex::Real> xs;
+    pp.getarr("points", xs);
+    if (xs.size() % AMREX_SPACEDIM != 0) {
+      amrex::Abort("probes." + name + ".points must be a list of coordinates");
+    }
+    for (int n = 0; n < xs.size() / AMREX_SPACEDIM; ++n) {
+      points.emplace_back(&xs[AMREX_SPACEDIM * n]);
+    }
+  } else if (type == "line") {
+    amrex::Vector<amrex::Real> start, end;
+    pp.getarr("start", start, 0, AMREX_SPACEDIM);
+    pp.getarr("end", end, 0, AMREX_SPACEDIM);
+    int npts = 1;
+    pp.get("npts", npts);
+    const amrex::RealVect x0(start.data());
+    const amrex::RealVect dx =
+      (npts > 1) ? (amrex::RealVect(end.data()) - x0) / (npts - 1)
+                 : amrex::RealVect::TheZeroVector();
+    for (int i = 0; i < npts; ++i) {
+      points.push_back(x0 + i * dx);
+    }
+  } else if (type == "plane") {
+    amrex::Vector<amrex::Real> origin, axis1, axis2;
+    amrex::Vector<int> npts;
+    pp.getarr("origin", origin, 0, AMREX_SPACEDIM);
+    pp.getarr("axis1", axis1, 0, AMREX_SPACEDIM);
+    pp.getarr("axis2", axis2, 0, AMREX_SPACEDIM);
+    pp.getarr("npts", npts, 0, 2);
+    const amrex::RealVect x0(origin.data());
+    const amrex::RealVect dx1 =
+      (npts[0] > 1) ? amrex::RealVect(axis1.data()) / (npts[0] - 1)
+                    : amrex::RealVect::TheZeroVector();
+    const amrex::RealVect dx2 =
+      (npts[1] > 1) ? amrex::RealVect(axis2.data()) / (npts[1] - 1)
+                    : amrex::RealVect::TheZeroVector();
+    for (int j = 0; j < npts[1]; ++j) {
+      for (int i = 0; i < npts[0]; ++i) {
+        points.push_back(x0 + i * dx1 + j * dx2);
+      }
+    }
+  } else {
+    amrex::Abort("Unknown type of probe " + name + ": " + type);
+  }
+
+  const amrex::RealBox& domain = amrex::DefaultGeometry().ProbDomain();
+  int nout = 0;
+  for (const auto& x : points) {
+    if (domain.contains(x.dataPtr(), 1.0e-12)) {
+      m_points.push_back(x);
+      m_point_probe.push_back(name);
+    } else {
+      nout++;
+    }
+  }
+  if (nout > 0) {
+    amrex::Print() << "Warning: " << nout << " points of probe " << name
+                   << " are outside the domain and are ignored" << std::endl;
+  }
+}
+
+void
+Probes::writeHeader() const
+{
+  std::ofstream ofs(m_dir + "/probes_header.txt");
+  ofs << "# vars:";
+  for (const auto& var : m_var_names) {
+    ofs << " " << var;
+  }
+  ofs << "\n# record: int64 step, float64 time, int32 n, int32 id[n], "
+      << "float64 value[n][nvars]\n";
+  ofs << "# id probe x y z\n";
+  ofs << std::setprecision(std::numeric_limits<amrex::Real>::max_digits10);
+  for (int id = 0; id < m_points.size(); ++id) {
+    ofs << id << " " << m_point_probe[id];
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+      ofs << " " << m_points[id][dir];
+    }
+    ofs << "\n";
+  }
+}
+
+void
+Probes::setComponents(const amrex::Vector<int>& comps)
+{
+  m_comps = comps;
+}
+
+bool
+Probes::sameLayout(const amrex::Vector<const amrex::MultiFab*>& state) const
+{
+  if (state.size() != m_grids.size()) {
+    return false;
+  }
+  for (int lev = 0; lev < state.size(); ++lev) {
+    if (
+      (state[lev]->boxArray() != m_grids[lev]) ||
+      (state[lev]->DistributionMap() != m_dmaps[lev])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void
+Probes::locate(
+  const amrex::Vector<const amrex::MultiFab*>& state,
+  const amrex::Vector<amrex::Geometry>& geoms)
+{
+  BL_PROFILE("Probes::locate()");
+
+  const int nlevels = static_cast<int>(state.size());
+  m_grids.resize(nlevels);
+  m_dmaps.resize(nlevels);
+  for (int lev = 0; lev < nlevels; ++lev) {
+    m_grids[lev] = state[lev]->boxArray();
+    m_dmaps[lev] = state[lev]->DistributionMap();
+  }
+
+  // Each point belongs to the finest level containing it
+  amrex::Vector<amrex::Vector<Stencil>> stencils(nlevels);
+  const int myproc = amrex::ParallelDescriptor::MyProc();
+  for (int id = 0; id < m_points.size(); ++id) {
+    const amrex::RealVect& x = m_points[id];
+    for (int lev = nlevels - 1; lev >= 0; --lev) {
+      const amrex::Box& domain = geoms[lev].Domain();
+      const auto plo = geoms[lev].ProbLoArray();
+      const auto dxinv = geoms[lev].InvCellSizeArray();
+      amrex::IntVect cell;
+      for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        cell[dir] = static_cast<int>(
+          amrex::Math::floor((x[dir] - plo[dir]) * dxinv[dir]));
+        cell[dir] = amrex::Clamp(
+          cell[dir], domain.smallEnd(dir), domain.bigEnd(dir));
+      }
+      const auto isects =
+        m_grids[lev].intersections(amrex::Box(cell, cell), true, 0);
+      if (isects.empty()) {
+        continue;
+      }
+      const int box_index = isects[0].first;
+      if (m_dmaps[lev][box_index] == myproc) {
+        // Linear interpolation between the cell centers of the owning box,
+        // falling back to one-sided near the box edges
+        const amrex::Box& bx = m_grids[lev][box_index];
+        amrex::GpuArray<int, 3> lo = {0, 0, 0};
+        amrex::GpuArray<int, 3> hi = {0, 0, 0};
+        Stencil s{};
+        s.t = {0.0, 0.0, 0.0};
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+          const amrex::Real xi = (x[dir] - plo[dir]) * dxinv[dir] - 0.5;
+          int i0 = static_cast<int>(amrex::Math::floor(xi));
+          amrex::Real t = xi - i0;
+          if (i0 < bx.smallEnd(dir)) {
+            i0 = bx.smallEnd(dir);
+            t = 0.0;
+          }
+          if (i0 >= bx.bigEnd(dir)) {
+            i0 = bx.bigEnd(dir);
+            t = 0.0;
+          }
+          lo[dir] = i0;
+          hi[dir] = (t > 0.0) ? i0 + 1 : i0;
+          s.t[dir] = t;
+        }
+        s.id = id;
+        s.local_index = state[lev]->localindex(box_index);
+        s.lo = amrex::Dim3{lo[0], lo[1], lo[2]};
+        s.hi = amrex::Dim3{hi[0], hi[1], hi[2]};
+        stencils[lev].push_back(s);
+      }
+      break;
+    }
+  }
+
+  m_stencils.clear();
+  m_stencils.resize(nlevels);
+  m_local_ids.clear();
+  for (int lev = 0; lev < nlevels; ++lev) {
+    m_stencils[lev].resize(stencils[lev].size());
+    amrex::Gpu::copy(
+      amrex::Gpu::hostToDevice, stencils[lev].begin(), stencils[lev].end(),
+      m_stencils[lev].begin());
+    for (const auto& s : stencils[lev]) {
+      m_local_ids.push_back(s.id);
+    }
+  }
+}
+
+void
+Probes::sample(
+  const amrex::Vector<const amrex::MultiFab*>& state,
+  const amrex::Vector<amrex::Geometry>& geoms,
+  const int nstep,
+  const amrex::Real time)
+{
+  BL_PROFILE("Probes::sample()");
+
+  if (!sameLayout(state)) {
+    locate(state, geoms);
+  }
+
+  const int nlocal = static_cast<int>(m_local_ids.size());
+  if (nlocal == 0) {
+    return;
+  }
+
+  const int ncomp = static_cast<int>(m_comps.size());
+  amrex::Gpu::DeviceVector<int> d_comps(ncomp);
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, m_comps.begin(), m_comps.end(), d_comps.begin());
+  m_values.resize(static_cast<std::size_t>(nlocal) * ncomp);
+
+  int offset = 0;
+  for (int lev = 0; lev < state.size(); ++lev) {
+    const int npts = static_cast<int>(m_stencils[lev].size());
+    if (npts == 0) {
+      continue;
+    }
+    auto const& sarrs = state[lev]->const_arrays();
+    const Stencil* stencils = m_stencils[lev].data();
+    const int* comps = d_comps.data();
+    amrex::Real* values = m_values.data() + offset * ncomp;
+    amrex::ParallelFor(npts, [=] AMREX_GPU_DEVICE(int p) noexcept {
+      const Stencil& s = stencils[p];
+      const auto& sarr = sarrs[s.local_index];
+      for (int n = 0; n < ncomp; ++n) {
+        amrex::Real v = 0.0;
+        for (int c = 0; c < 8; ++c) {
+          const int ci = c & 1;
+          const int cj = (c >> 1) & 1;
+          const int ck = (c >> 2) & 1;
+          const amrex::Real w = (ci ? s.t[0] : 1.0 - s.t[0]) *
+                                (cj ? s.t[1] : 1.0 - s.t[1]) *
+                                (ck ? s.t[2] : 1.0 - s.t[2]);
+          v += w * sarr(
+                     ci ? s.hi.x : s.lo.x, cj ? s.hi.y : s.lo.y,
+                     ck ? s.hi.z : s.lo.z, comps[n]);
+        }
+        values[p * ncomp + n] = v;
+      }
+    });
+    offset += npts;
+  }
+
+  amrex::Vector<amrex::Real> h_values(m_values.size());
+  amrex::Gpu::copy(
+    amrex::Gpu::deviceToHost, m_values.begin(), m_values.end(),
+    h_values.begin());
+
+  const auto step = static_cast<std::int64_t>(nstep);
+  const auto t = static_cast<double>(time);
+  const auto n = static_cast<std::int32_t>(nlocal);
+  append(m_buffer, &step, 1);
+  append(m_buffer, &t, 1);
+  append(m_buffer, &n, 1);
+  for (const int id : m_local_ids) {
+    const auto id32 = static_cast<std::int32_t>(id);
+    append(m_buffer, &id32, 1);
+  }
+  for (const amrex::Real v : h_values) {
+    const auto v64 = static_cast<double>(v);
+    append(m_buffer, &v64, 1);
+  }
+
+  if (m_buffer.size() >= m_buffer_size) {
+    flush();
+  }
+}
+
+void
+Probes::flush()
+{
+  if (m_buffer.empty()) {
+    return;
+  }
+
+  // The write buffer is in use until the previous write completes
+  wait();
+  std::swap(m_buffer, m_write_buffer);
+  m_buffer.clear();
+
+  const std::string fname =
+    m_dir + "/" +
+    amrex::Concatenate("probes.", amrex::ParallelDescriptor::MyProc(), 5) +
+    ".bin";
+  m_writer = std::thread([this, fname]() {
+    std::ofstream ofs(fname, std::ios::binary | std::ios::app);
+    ofs.write(m_write_buffer.data(), m_write_buffer.size());
+  });
+}
+
+void
+Probes::wait()
+{
+  if (m_writer.joinable()) {
+    m_writer.join();
+  }
+}
+
+void
+Probes::finalize()
+{
+  flush();
+  wait();
+}
+} // namespace pele
@@ -35,6 +35,7 @@ PeleC::react_state(
 {
   // Update I_R, and recompute S_new
   BL_PROFILE("PeleC::react_state()");
+  pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::reactions);
 
   const amrex::Real strt_time = amrex::ParallelDescriptor::second();
 
@@ -71,10 +72,8 @@ PeleC::react_state(
       non_react_src = &non_react_src_tmp;
 
       for (int src : src_list) {
-        amrex::MultiFab::Saxpy(
-          non_react_src_tmp, 0.5, *new_sources[src], 0, 0, NVAR, ng);
-        amrex::MultiFab::Saxpy(
-          non_react_src_tmp, 0.5, *old_sources[src], 0, 0, NVAR, ng);
+        saxpy_source(non_react_src_tmp, 0.5, *new_sources[src], src, ng);
+        saxpy_source(non_react_src_tmp, 0.5, *old_sources[src], src, ng);
       }
 
       if (do_hydro && !do_mol) {
@@ -102,6 +101,11 @@ PeleC::react_state(
   amrex::iMultiFab dummyMask(grids, dmap, 1, 0);
   amrex::MultiFab fctCount(grids, dmap, 1, 0);
   dummyMask.setVal(1);
+  pele::Telemetry::ScopedMemory telemetry_memory(
+    pele::Telemetry::mem_reactions,
+    pele::Telemetry::bytes(non_react_src_tmp) + pele::Telemetry::bytes(STemp) +
+      pele::Telemetry::bytes(extsrc_rY) + pele::Telemetry::bytes(extsrc_rE) +
+      pele::Telemetry::bytes(dummyMask) + pele::Telemetry::bytes(fctCount));
 
   if (!react_init) {
     const amrex::MultiFab& S_old = get_old_data(State_Type);
@@ -315,6 +319,10 @@ PeleC::react_state(
     }
   }
 
+  if (!telemetry_file.empty()) {
+    pele::Telemetry::recordRHSEvals(fctCount.max(0, 0, true));
+  }
+
   if (ng > 0) {
     S_new.FillBoundary(geom.periodicity());
   }
@@ -1,5 +1,6 @@
 #include <AMReX_ParmParse.H>
 #include <AMReX_buildInfo.H>
+#include <algorithm>
 #include <memory>
 
 #ifdef PELE_USE_MASA
@@ -403,8 +404,68 @@ PeleC::variableSetUp()
     Work_Estimate_Type, 0, "WorkEstimate", bc,
     amrex::StateDescriptor::BndryFunc(pc_nullfill));
 
+  // Running statistics: the accumulated time, then the mean and variance of
+  // each variable in pelec.stats_vars, then the covariance of each pair in
+  // pelec.stats_covariances
+  {
+    amrex::ParmParse pp("pelec");
+    pp.queryarr("stats_vars", stats_vars);
+    amrex::Vector<std::string> cov_names;
+    pp.queryarr("stats_covariances", cov_names);
+    if (cov_names.size() % 2 != 0) {
+      amrex::Abort("pelec.stats_covariances must be a list of pairs");
+    }
+    for (const auto& cov_name : cov_names) {
+      const auto it =
+        std::find(stats_vars.begin(), stats_vars.end(), cov_name);
+      if (it == stats_vars.end()) {
+        amrex::Abort(
+          "pelec.stats_covariances: " + cov_name +
+          " must be in pelec.stats_vars");
+      }
+      stats_pairs.push_back(static_cast<int>(it - stats_vars.begin()));
+    }
+  }
+  const int nstats_vars = static_cast<int>(stats_vars.size());
+  const int nstats_cov = static_cast<int>(stats_pairs.size()) / 2;
+  const int nstats = 1 + 2 * nstats_vars + nstats_cov;
+  desc_lst.addDescriptor(
+    Stats_Type, amrex::IndexType::TheCellType(), amrex::StateDescriptor::Point,
+    0, nstats, interp, state_data_extrap, doStats());
+  amrex::Vector<amrex::BCRec> stats_bcs(nstats);
+  amrex::Vector<std::string> stats_name(nstats);
+  set_react_src_bc(bc, phys_bc);
+  for (int i = 0; i < nstats; ++i) {
+    stats_bcs[i] = bc;
+  }
+  stats_name[0] = "stats_time";
+  for (int i = 0; i < nstats_vars; ++i) {
+    stats_name[1 + i] = "mean_" + stats_vars[i];
+    stats_name[1 + nstats_vars + i] = "var_" + stats_vars[i];
+  }
+  for (int i = 0; i < nstats_cov; ++i) {
+    const std::string& var_a = stats_vars[stats_pairs[2 * i]];
+    const std::string& var_b = stats_vars[stats_pairs[2 * i + 1]];
+    stats_name[1 + 2 * nstats_vars + i] = "cov_" + var_a + "_" + var_b;
+  }
+  desc_lst.setComponent(Stats_Type, 0, stats_name, stats_bcs, bndryfunc2);
+
   num_state_type = desc_lst.size();
 
+  if (pele::Probes::defined()) {
+    probes = std::make_unique<pele::Probes>();
+    amrex::Vector<int> probe_comps;
+    for (const auto& var : probes->varNames()) {
+      int typ = -1;
+      int comp = -1;
+      if (!isStateVariable(var, typ, comp) || (typ != State_Type)) {
+        amrex::Abort("probes.vars: " + var + " is not a state variable");
+      }
+      probe_comps.push_back(comp);
+    }
+    probes->setComponents(probe_comps);
+  }
+
   // Get the level at which EB is generated
   eb_max_lvl_gen = getEBMaxLevel();
 
@@ -673,6 +734,13 @@ PeleC::variableCleanUp()
 
   clear_prob();
 
+  probes.reset();
+
+  finish_lundgren_forcing();
+
+  // Also waits for the turbulent inflow prefetch
+  pc_bcfill_clear_cache();
+
   eb_initialized = false;
 
   delete prob_parm_host;
@@ -155,8 +155,19 @@ PeleC::fill_soot_source(
           mu_arr(i, j, k) = mu;
         });
     }
-    auto const& soot_arr = soot_fab.array();
+    // The soot model indexes its source with the state layout, so compute it
+    // on the whole state and keep the footprint of soot_src
+    amrex::FArrayBox soot_full(bx, NVAR, amrex::The_Async_Arena());
+    soot_full.setVal<amrex::RunOn::Device>(0.0);
+    auto const& soot_arr = soot_full.array();
     soot_model.computeSootSourceTerm(bx, q_arr, mu_arr, soot_arr, time, dt);
+    const SourceFootprint fp = source_footprint(soot_src);
+    int offset = 0;
+    for (int r = 0; r < fp.nranges; r++) {
+      soot_fab.copy<amrex::RunOn::Device>(
+        soot_full, bx, fp.scomp[r], bx, offset, fp.ncomp[r]);
+      offset += fp.ncomp[r];
+    }
   }
 }
 
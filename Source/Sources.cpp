@@ -12,6 +12,7 @@ PeleC::construct_old_source(
   int sub_ncycle)
 {
   AMREX_ASSERT(src >= 0 && src < num_src);
+  pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::sources);
 
 #ifndef PELE_USE_SPRAY
   amrex::ignore_unused(amr_ncycle);
@@ -61,6 +62,7 @@ PeleC::construct_new_source(
   int sub_ncycle)
 {
   AMREX_ASSERT(src >= 0 && src < num_src);
+  pele::Telemetry::ScopedPhase telemetry_phase(pele::Telemetry::sources);
 
 #ifndef PELE_USE_SPRAY
   amrex::ignore_unused(amr_ncycle);
@@ -107,7 +109,7 @@ PeleC::sum_of_sources(amrex::MultiFab& source)
   source.setVal(0.0);
 
   for (int src : src_list) {
-    amrex::MultiFab::Add(source, *old_sources[src], 0, 0, NVAR, ng);
+    saxpy_source(source, 1.0, *old_sources[src], src, ng);
   }
 
   if (do_hydro) {
@@ -115,6 +117,79 @@ PeleC::sum_of_sources(amrex::MultiFab& source)
   }
 
   for (int src : src_list) {
-    amrex::MultiFab::Add(source, *new_sources[src], 0, 0, NVAR, ng);
+    saxpy_source(source, 1.0, *new_sources[src], src, ng);
+  }
+}
+
+SourceFootprint
+PeleC::source_footprint(int src)
+{
+  SourceFootprint fp;
+  switch (src) {
+  case forcing_src:
+    // Momentum only, see fill_forcing_source
+    fp.clear();
+    fp.add(UMX, UMZ - UMX + 1);
+    break;
+  case ext_src:
+    // Momentum and energy, unless the problem adds its own sources
+    if (!problem_modifies_ext_source()) {
+      fp.clear();
+      fp.add(UMX, UEDEN - UMX + 1);
+    }
+    break;
+  case spray_src:
+    // Density, momentum, energy and species, see transferSource
+    fp.clear();
+    fp.add(URHO, UEDEN - URHO + 1);
+    fp.add(UFS, NUM_SPECIES);
+    break;
+#ifdef PELE_USE_SOOT
+  case soot_src:
+    // Density, energy, species and soot moments, see fill_soot_source
+    fp.clear();
+    fp.add(URHO, 1);
+    fp.add(UEDEN, 1);
+    fp.add(UFS, NUM_SPECIES);
+    fp.add(UFSOOT, NUM_SOOT_MOMENTS + 1);
+    break;
+#endif
+  default:
+    // The other sources are filled by code that indexes them with the full
+    // state layout
+    break;
+  }
+  return fp;
+}
+
+void
+PeleC::saxpy_source(
+  amrex::MultiFab& dst,
+  amrex::Real a,
+  const amrex::MultiFab& src_mf,
+  int src,
+  int ng)
+{
+  const SourceFootprint fp = source_footprint(src);
+  AMREX_ASSERT(src_mf.nComp() == fp.size());
+  int offset = 0;
+  for (int r = 0; r < fp.nranges; r++) {
+    amrex::MultiFab::Saxpy(
+      dst, a, src_mf, offset, fp.scomp[r], fp.ncomp[r], ng);
+    offset += fp.ncomp[r];
+  }
+}
+
+void
+PeleC::pack_source(
+  const amrex::MultiFab& full, amrex::MultiFab& src_mf, int src, int ng)
+{
+  const SourceFootprint fp = source_footprint(src);
+  AMREX_ASSERT(full.nComp() == NVAR);
+  AMREX_ASSERT(src_mf.nComp() == fp.size());
+  int offset = 0;
+  for (int r = 0; r < fp.nranges; r++) {
+    amrex::MultiFab::Copy(src_mf, full, fp.scomp[r], offset, fp.ncomp[r], ng);
+    offset += fp.ncomp[r];
   }
 }
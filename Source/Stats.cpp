@@ -0,0 +1,82 @@
+#include "PeleC.H"
+
+namespace {
+// Time of the last sample, the first sample after a start or a restart is
+// weighted by the sampling interval
+amrex::Real stats_last_time = -1.0;
+} // namespace
+
+void
+PeleC::accumulate_stats(const amrex::Real time)
+{
+  BL_PROFILE("PeleC::accumulate_stats()");
+  AMREX_ASSERT(level == 0);
+
+  const amrex::Real w = (stats_last_time < 0.0)
+                          ? stats_int * parent->dtLevel(0)
+                          : time - stats_last_time;
+  stats_last_time = time;
+  if (w <= 0.0) {
+    return;
+  }
+
+  const int nvars = static_cast<int>(stats_vars.size());
+  const int ncov = static_cast<int>(stats_pairs.size()) / 2;
+  amrex::Gpu::DeviceVector<int> d_pairs(stats_pairs.size());
+  amrex::Gpu::copy(
+    amrex::Gpu::hostToDevice, stats_pairs.begin(), stats_pairs.end(),
+    d_pairs.begin());
+  const int* pairs = d_pairs.data();
+
+  for (int lev = 0; lev <= parent->finestLevel(); ++lev) {
+    PeleC& pc_lev = getLevel(lev);
+    amrex::MultiFab& stats = pc_lev.get_new_data(Stats_Type);
+
+    amrex::MultiFab fields(stats.boxArray(), stats.DistributionMap(), nvars, 0);
+    for (int v = 0; v < nvars; ++v) {
+      // Either a derive, possibly a component of it, or a state variable
+      const auto mf = pc_lev.derive(stats_vars[v], time, 0);
+      int varIdx = 0;
+      if (derive_lst.canDerive(stats_vars[v])) {
+        const amrex::DeriveRec* rec = derive_lst.get(stats_vars[v]);
+        for (int vd = 0; vd < rec->numDerive(); ++vd) {
+          if (stats_vars[v] == rec->variableName(vd)) {
+            varIdx = vd;
+            break;
+          }
+        }
+      }
+      amrex::MultiFab::Copy(fields, *mf, varIdx, v, 1, 0);
+    }
+
+    // Weighted Welford update of the mean, variance and covariances, which are
+    // kept normalized by the accumulated time so that they interpolate
+    // conservatively on regrid
+    auto const& starrs = stats.arrays();
+    auto const& farrs = fields.const_arrays();
+    amrex::ParallelFor(
+      stats, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+        auto const& st = starrs[nbx];
+        auto const& q = farrs[nbx];
+        const amrex::Real f = w / (st(i, j, k, 0) + w);
+        st(i, j, k, 0) += w;
+        // Covariances first, as they use the means before the update
+        for (int c = 0; c < ncov; ++c) {
+          const int a = pairs[2 * c];
+          const int b = pairs[2 * c + 1];
+          const amrex::Real da = q(i, j, k, a) - st(i, j, k, 1 + a);
+          const amrex::Real db = q(i, j, k, b) - st(i, j, k, 1 + b);
+          const int n = 1 + 2 * nvars + c;
+          st(i, j, k, n) =
+            (1.0 - f) * st(i, j, k, n) + f * (1.0 - f) * da * db;
+        }
+        for (int v = 0; v < nvars; ++v) {
+          const amrex::Real d = q(i, j, k, v) - st(i, j, k, 1 + v);
+          st(i, j, k, 1 + v) += f * d;
+          st(i, j, k, 1 + nvars + v) =
+            (1.0 - f) * st(i, j, k, 1 + nvars + v) + f * (1.0 - f) * d * d;
+        }
+      });
+    amrex::Gpu::synchronize();
+  }
+}
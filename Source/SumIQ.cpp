@@ -22,6 +22,7 @@ PeleC::sum_integrated_quantities()
   amrex::Real rho_E = 0.0;
   amrex::Real fuel_prod = 0;
   amrex::Real temp = 0;
+  amrex::Real spray_mass = 0.0;
 
   for (int lev = 0; lev <= finest_level; lev++) {
     PeleC& pc_lev = getLevel(lev);
@@ -39,12 +40,18 @@ PeleC::sum_integrated_quantities()
     }
 
     temp += pc_lev.volWgtSum("Temp", time, local_flag);
+
+#ifdef PELE_USE_SPRAY
+    if (do_spray_particles) {
+      spray_mass += pc_lev.sprayMass();
+    }
+#endif
   }
 
   if (verbose > 0) {
     const int nfoo = 10;
     amrex::Real foo[nfoo] = {mass,  mom[0], mom[1],    mom[2], rho_e,
-                             rho_K, rho_E,  fuel_prod, temp};
+                             rho_K, rho_E,  fuel_prod, temp,   spray_mass};
     amrex::ParallelDescriptor::ReduceRealSum(
       foo, nfoo, amrex::ParallelDescriptor::IOProcessorNumber());
 
@@ -59,6 +66,7 @@ PeleC::sum_integrated_quantities()
       rho_E = foo[i++];
       fuel_prod = foo[i++];
       temp = foo[i++];
+      spray_mass = foo[i++];
 
       amrex::Print() << '\n';
       amrex::Print() << "TIME = " << time << " MASS        = " << mass << '\n';
@@ -73,6 +81,10 @@ PeleC::sum_integrated_quantities()
       amrex::Print() << "TIME = " << time << " RHO*E       = " << rho_E << '\n';
       amrex::Print() << "TIME = " << time << " FUEL PROD   = " << fuel_prod
                      << '\n';
+      if (do_spray_particles) {
+        amrex::Print() << "TIME = " << time << " SPRAY MASS  = " << spray_mass
+                       << '\n';
+      }
 
       const int log_index = find_datalog_index("datlog");
       if (log_index >= 0) {
@@ -90,6 +102,9 @@ PeleC::sum_integrated_quantities()
             data_log1 << std::setw(datwidth) << "         rho_E";
             data_log1 << std::setw(datwidth) << "     fuel_prod";
             data_log1 << std::setw(datwidth) << "          temp";
+            if (do_spray_particles) {
+              data_log1 << std::setw(datwidth) << "    spray_mass";
+            }
             data_log1 << std::endl;
           }
 
@@ -114,6 +129,10 @@ PeleC::sum_integrated_quantities()
                     << fuel_prod;
           data_log1 << std::setw(datwidth) << std::setprecision(datprecision)
                     << temp;
+          if (do_spray_particles) {
+            data_log1 << std::setw(datwidth) << std::setprecision(datprecision)
+                      << spray_mass;
+          }
           data_log1 << std::endl;
         }
       }
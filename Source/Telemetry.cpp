@@ -0,0 +1,187 @@
+#include <AMReX_Algorithm.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+
+#include "Telemetry.H"
+
+namespace pele {
+
+std::array<amrex::Real, Telemetry::num_phases> Telemetry::s_time = {0.0};
+int Telemetry::s_current = -1;
+amrex::Real Telemetry::s_start = 0.0;
+amrex::Vector<std::string> Telemetry::s_limiter;
+amrex::Vector<amrex::Real> Telemetry::s_courno;
+amrex::Real Telemetry::s_max_rhs_evals = 0.0;
+std::map<const void*, std::array<amrex::Long, Telemetry::num_memory>>
+  Telemetry::s_level_mem;
+std::array<amrex::Long, Telemetry::num_memory> Telemetry::s_global_mem = {0};
+std::array<amrex::Long, Telemetry::num_memory> Telemetry::s_temp_mem = {0};
+std::array<amrex::Long, Telemetry::num_memory> Telemetry::s_peak_mem = {0};
+std::array<amrex::Long, Telemetry::num_memory> Telemetry::s_at_peak_mem = {0};
+amrex::Long Telemetry::s_peak_total = 0;
+
+Telemetry::ScopedPhase::ScopedPhase(Phase phase) : m_parent(s_current)
+{
+  switchTo(phase);
+}
+
+Telemetry::ScopedPhase::~ScopedPhase() { switchTo(m_parent); }
+
+Telemetry::ScopedMemory::ScopedMemory(Memory tag, amrex::Long nbytes)
+  : m_tag(tag), m_nbytes(nbytes)
+{
+  s_temp_mem[m_tag] += m_nbytes;
+  updateMemoryPeak();
+}
+
+Telemetry::ScopedMemory::~ScopedMemory() { s_temp_mem[m_tag] -= m_nbytes; }
+
+void
+Telemetry::switchTo(int phase)
+{
+  const amrex::Real now = amrex::ParallelDescriptor::second();
+  if (s_current >= 0) {
+    s_time[s_current] += now - s_start;
+  }
+  s_current = phase;
+  s_start = now;
+}
+
+const char*
+Telemetry::phaseName(int phase)
+{
+  static const std::array<const char*, num_phases> names = {
+    "hydro", "diffusion", "reactions", "sources",
+    "fillpatch", "regrid", "io"};
+  return names[phase];
+}
+
+void
+Telemetry::setDtLimiter(int lev, const std::string& limiter)
+{
+  if (s_limiter.size() <= lev) {
+    s_limiter.resize(lev + 1);
+  }
+  s_limiter[lev] = limiter;
+}
+
+void
+Telemetry::recordCourant(int lev, amrex::Real courno)
+{
+  if (s_courno.size() <= lev) {
+    s_courno.resize(lev + 1, 0.0);
+  }
+  s_courno[lev] = amrex::max<amrex::Real>(s_courno[lev], courno);
+}
+
+void
+Telemetry::recordRHSEvals(amrex::Real nevals)
+{
+  s_max_rhs_evals = amrex::max<amrex::Real>(s_max_rhs_evals, nevals);
+}
+
+void
+Telemetry::reset()
+{
+  s_time.fill(0.0);
+  for (auto& c : s_courno) {
+    c = 0.0;
+  }
+  s_max_rhs_evals = 0.0;
+}
+
+const char*
+Telemetry::memoryName(int tag)
+{
+  static const std::array<const char*, num_memory> names = {
+    "state", "sborder", "hydro_sources", "sources", "les",
+    "geometry", "mol", "reactions", "plot"};
+  return names[tag];
+}
+
+void
+Telemetry::setLevelMemory(const void* owner, Memory tag, amrex::Long nbytes)
+{
+  // New entries are value initialized to zero
+  s_level_mem[owner][tag] = nbytes;
+  updateMemoryPeak();
+}
+
+void
+Telemetry::clearLevelMemory(const void* owner)
+{
+  s_level_mem.erase(owner);
+}
+
+void
+Telemetry::setMemory(Memory tag, amrex::Long nbytes)
+{
+  s_global_mem[tag] = nbytes;
+  updateMemoryPeak();
+}
+
+std::array<amrex::Long, Telemetry::num_memory>
+Telemetry::liveMemory()
+{
+  std::array<amrex::Long, num_memory> live = s_temp_mem;
+  for (int m = 0; m < num_memory; ++m) {
+    live[m] += s_global_mem[m];
+  }
+  for (const auto& owner_mem : s_level_mem) {
+    for (int m = 0; m < num_memory; ++m) {
+      live[m] += owner_mem.second[m];
+    }
+  }
+  return live;
+}
+
+void
+Telemetry::updateMemoryPeak()
+{
+  const auto live = liveMemory();
+  amrex::Long total = 0;
+  for (int m = 0; m < num_memory; ++m) {
+    s_peak_mem[m] = amrex::max(s_peak_mem[m], live[m]);
+    total += live[m];
+  }
+  if (total > s_peak_total) {
+    s_peak_total = total;
+    s_at_peak_mem = live;
+  }
+}
+
+amrex::Vector<amrex::Long>
+Telemetry::reduceMemory()
+{
+  amrex::Vector<amrex::Long> mem(3 * num_memory + 2, 0);
+  const auto live = liveMemory();
+  for (int m = 0; m < num_memory; ++m) {
+    mem[m] = live[m];
+    mem[num_memory + m] = s_peak_mem[m];
+    mem[2 * num_memory + m] = s_at_peak_mem[m];
+    mem[3 * num_memory] += mem[m];
+  }
+  mem[3 * num_memory + 1] = s_peak_total;
+  amrex::ParallelDescriptor::ReduceLongMax(
+    mem.data(), static_cast<int>(mem.size()),
+    amrex::ParallelDescriptor::IOProcessorNumber());
+  return mem;
+}
+
+void
+Telemetry::printMemory()
+{
+  const auto mem = reduceMemory();
+  const amrex::Real mb = 1.0 / (1024.0 * 1024.0);
+  amrex::Print() << "Memory by subsystem, max over ranks [MB]: "
+                 << "(live, peak, at total peak)\n";
+  for (int m = 0; m < num_memory; ++m) {
+    amrex::Print() << "  " << memoryName(m) << ": " << mem[m] * mb << ", "
+                   << mem[num_memory + m] * mb << ", "
+                   << mem[2 * num_memory + m] * mb << "\n";
+  }
+  amrex::Print() << "  total: " << mem[3 * num_memory] * mb << ", "
+                 << mem[3 * num_memory + 1] * mb << std::endl;
+}
+
+} // namespace pele
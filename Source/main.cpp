@@ -149,6 +149,7 @@ main(int argc, char* argv[])
   }
 
   amrex::Real dRunTime2 = amrex::ParallelDescriptor::second();
+  pele::Telemetry::reset();
   amrex::Real wall_time_elapsed{0.0};
 
   while (
@@ -157,10 +158,12 @@ main(int argc, char* argv[])
     (amrptr->cumTime() < stop_time || stop_time < 0.0) &&
     (wall_time_elapsed < (max_wall_time * 3600.0) || max_wall_time < 0.0)) {
     // Do a timestep
+    const amrex::Real dStepTime0 = amrex::ParallelDescriptor::second();
     amrptr->coarseTimeStep(stop_time);
 #ifdef AMREX_USE_ASCENT
     amrptr->doInSituViz(amrptr->levelSteps(0));
 #endif
+    amrptr->writeTelemetry(amrex::ParallelDescriptor::second() - dStepTime0);
     // Get the elapsed time
     wall_time_elapsed = amrex::ParallelDescriptor::second() - dRunTime1;
     amrex::ParallelDescriptor::ReduceRealMax(wall_time_elapsed);
@@ -188,6 +191,8 @@ main(int argc, char* argv[])
                    << time_now.tm_mday << "." << std::endl;
   }
 
+  pele::Telemetry::printMemory();
+
   delete amrptr;
 
   // This MUST follow the above delete as ~Amr() may dump files to disk
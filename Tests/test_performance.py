@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# ========================================================================
+#
+# Imports
+#
+# ========================================================================
+import argparse
+import json
+import os
+import re
+import sys
+
+# ========================================================================
+#
+# Some defaults variables
+#
+# ========================================================================
+# Exit code that CTest is told to report as a skipped test
+SKIP_RETURN_CODE = 77
+
+# Profiled regions compared against the baseline; each entry is a regular
+# expression matched against the full TinyProfiler region name
+DEFAULT_REGIONS = [
+    r"PeleC::react_state\(\)",
+    r"PeleC::getMOLSrcTerm\(\)",
+    r"PeleC::umdrv\(\)",
+    r"FillPatch.*",
+]
+
+
+# ========================================================================
+#
+# Function definitions
+#
+# ========================================================================
+def parse_tiny_profiler(fname):
+    """Return the inclusive max time of every region in a TinyProfiler log."""
+    times = {}
+    in_table = False
+    with open(fname, "r") as f:
+        for line in f:
+            tokens = line.split()
+            if not tokens or tokens[0] == "Name":
+                in_table = tokens[1:2] == ["NCalls"] and "Incl." in tokens
+                continue
+            if not in_table or len(tokens) < 6 or line.startswith("-"):
+                continue
+            # Name NCalls Min Avg Max Max%, where the name may contain spaces
+            try:
+                tmax = float(tokens[-2])
+            except ValueError:
+                continue
+            times[" ".join(tokens[:-5])] = tmax
+    return times
+
+
+def region_times(times, regions):
+    """Time of each region, taken as the outermost of all matching entries."""
+    result = {}
+    for region in regions:
+        matches = [t for name, t in times.items() if re.fullmatch(region, name)]
+        if matches:
+            result[region] = max(matches)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare TinyProfiler region timings against a baseline"
+    )
+    parser.add_argument("-l", "--log", help="PeleC log file", required=True)
+    parser.add_argument("-b", "--baseline", help="Baseline file", required=True)
+    parser.add_argument(
+        "-s", "--save", help="Save the baseline instead", action="store_true"
+    )
+    parser.add_argument(
+        "-t",
+        "--tolerance",
+        help="Allowed relative slowdown of a region",
+        type=float,
+        default=0.15,
+    )
+    parser.add_argument(
+        "-m",
+        "--min_time",
+        help="Timings below this many seconds are compared as this value",
+        type=float,
+        default=0.01,
+    )
+    parser.add_argument(
+        "-r", "--regions", help="Region regexes", nargs="+", default=DEFAULT_REGIONS
+    )
+    args = parser.parse_args()
+
+    times = parse_tiny_profiler(args.log)
+    if not times:
+        print(f"No TinyProfiler output found in {args.log}")
+        return 1
+    current = region_times(times, args.regions)
+
+    if args.save:
+        os.makedirs(os.path.dirname(os.path.abspath(args.baseline)), exist_ok=True)
+        with open(args.baseline, "w") as f:
+            json.dump({"regions": current}, f, indent=2)
+        print(f"Saved baseline to {args.baseline}")
+        return 0
+
+    if not os.path.isfile(args.baseline):
+        print(f"No baseline found at {args.baseline}")
+        return SKIP_RETURN_CODE
+    with open(args.baseline, "r") as f:
+        baseline = json.load(f)
+    tolerance = baseline.get("tolerance", args.tolerance)
+
+    failed = False
+    print(f"{'region':<32s} {'baseline':>10s} {'current':>10s} {'ratio':>8s}")
+    for region, tref in baseline["regions"].items():
+        if region not in current:
+            print(f"{region:<32s} {tref:10.4f} {'missing':>10s}")
+            failed = True
+            continue
+        ratio = max(current[region], args.min_time) / max(tref, args.min_time)
+        status = "SLOWER" if ratio > 1.0 + tolerance else ""
+        print(
+            f"{region:<32s} {tref:10.4f} {current[region]:10.4f} "
+            f"{ratio:8.3f} {status}"
+        )
+        failed = failed or bool(status)
+
+    return 1 if failed else 0
+
+
+# ========================================================================
+#
+# Main
+#
+# ========================================================================
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,37 @@
+# ========================================================================
+#
+# Imports
+#
+# ========================================================================
+import os
+import numpy.testing as npt
+import pandas as pd
+import unittest
+
+
+# ========================================================================
+#
+# Test definitions
+#
+# ========================================================================
+class SprayConsTestCase(unittest.TestCase):
+    """Tests for conservation in Pele with spray particles."""
+
+    def test_conservation(self):
+        """Is the mass of the gas and the particles conserved?"""
+
+        # Load the data
+        fdir = os.path.abspath(".")
+        fname = os.path.join(fdir, "datlog")
+        df = pd.read_csv(fname, delim_whitespace=True)
+        total_mass = df.mass + df.spray_mass
+        npt.assert_allclose(total_mass, total_mass[0], rtol=1e-10)
+
+
+# ========================================================================
+#
+# Main
+#
+# ========================================================================
+if __name__ == "__main__":
+    unittest.main()